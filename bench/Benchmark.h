@@ -0,0 +1,102 @@
+#ifndef BIG_NUMBERS_BENCHMARK_H
+#define BIG_NUMBERS_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace BigNumbers {
+    namespace Benchmark {
+        struct Options {
+            // Each measurement repeats operation until this amount of seconds passes.
+            double minTime = 0.1;
+
+            // Operands are never longer than this amount of limbs, nor longer than limit of operation.
+            std::size_t maxLimbs = 1000000;
+
+            // Only operations, which contain this substring, are measured.
+            std::string filter;
+
+            bool isJson = false;
+        };
+
+        struct Result {
+            std::string operation;
+            std::string pieceType;
+            std::size_t size;
+            std::size_t iterations;
+            double meanNanoseconds;
+            double minNanoseconds;
+        };
+
+        // Results of operations are accumulated here, so that compiler does not drop them.
+        extern volatile std::size_t sink;
+
+        // Sizes 1, 10, ..., 10^6, which do not exceed given limits.
+        inline std::vector<std::size_t> sizesUpTo(std::size_t limit, const Options &options) {
+            std::vector<std::size_t> sizes;
+
+            for (std::size_t size = 1; size <= std::min(limit, options.maxLimbs) && size <= 1000000; size *= 10) {
+                sizes.push_back(size);
+            }
+
+            return sizes;
+        }
+
+        // Runs operation until minimal time passes, at least once. Operation returns any value derived from its
+        // result.
+        template<class Operation>
+        Result measure(const std::string &operation, const std::string &pieceType, std::size_t size,
+                       const Options &options, Operation &&run) {
+            using Clock = std::chrono::steady_clock;
+
+            Result result{operation, pieceType, size, 0, 0, 0};
+            double total = 0;
+
+            while (result.iterations == 0 || total < options.minTime * 1e9) {
+                auto start = Clock::now();
+                sink = sink + run();
+                double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+                result.minNanoseconds = result.iterations == 0 ? elapsed : std::min(result.minNanoseconds, elapsed);
+                total += elapsed;
+                ++result.iterations;
+            }
+
+            result.meanNanoseconds = total / static_cast<double>(result.iterations);
+
+            return result;
+        }
+
+        inline void writeCsv(std::ostream &output, const std::vector<Result> &results) {
+            output << "operation,piece_type,size,iterations,mean_ns,min_ns\n";
+
+            for (const auto &result: results) {
+                output << result.operation << ',' << result.pieceType << ',' << result.size << ','
+                       << result.iterations << ',' << static_cast<uint64_t>(result.meanNanoseconds) << ','
+                       << static_cast<uint64_t>(result.minNanoseconds) << '\n';
+            }
+        }
+
+        inline void writeJson(std::ostream &output, const std::vector<Result> &results) {
+            output << "[\n";
+
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const Result &result = results[i];
+
+                output << "  {\"operation\": \"" << result.operation << "\", \"piece_type\": \"" << result.pieceType
+                       << "\", \"size\": " << result.size << ", \"iterations\": " << result.iterations
+                       << ", \"mean_ns\": " << static_cast<uint64_t>(result.meanNanoseconds) << ", \"min_ns\": "
+                       << static_cast<uint64_t>(result.minNanoseconds) << (i + 1 < results.size() ? "},\n" : "}\n");
+            }
+
+            output << "]\n";
+        }
+    }
+}
+
+#endif //BIG_NUMBERS_BENCHMARK_H
@@ -0,0 +1,259 @@
+#include "Benchmark.h"
+
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+#include "BigIntBackend.h"
+#include "ParsingUtils.h"
+#include "config.h"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+using namespace BigNumbers;
+using namespace BigNumbers::Benchmark;
+
+volatile std::size_t BigNumbers::Benchmark::sink = 0;
+
+namespace {
+    // Operand limits in bits, which keep each measurement within seconds: linear operations reach 10^6 limbs of
+    // uint64_t, quadratic ones stop much earlier.
+    constexpr std::size_t LINEAR_LIMIT = 64000000;
+    constexpr std::size_t MULTIPLICATION_LIMIT = 6400000;
+    constexpr std::size_t DIVISION_LIMIT = 640000;
+    constexpr std::size_t CONVERSION_LIMIT = 64000;
+
+    // BigFloat operations are measured for precisions up to this amount of pieces and factorials up to this argument.
+    constexpr std::size_t FLOAT_LIMIT = 1000;
+    constexpr std::size_t FACTORIAL_LIMIT = 100000;
+
+    template<class T>
+    const char *pieceTypeName();
+
+    template<>
+    const char *pieceTypeName<uint8_t>() {
+        return "uint8_t";
+    }
+
+    template<>
+    const char *pieceTypeName<uint16_t>() {
+        return "uint16_t";
+    }
+
+#ifdef __SIZEOF_INT128__
+    template<>
+    const char *pieceTypeName<uint64_t>() {
+        return "uint64_t";
+    }
+#endif
+
+    template<class T>
+    BigIntBackend<T> random(std::size_t pieceCount, std::mt19937_64 &generator) {
+        std::vector<T> pieces;
+
+        for (std::size_t i = 1; i < pieceCount; ++i) {
+            pieces.push_back(static_cast<T>(generator()));
+        }
+
+        // Top piece is positive and non-zero, so operand keeps its length.
+        pieces.push_back(static_cast<T>(generator() >> 1 | 1));
+
+        return BigIntBackend<T>(false, pieces);
+    }
+
+    bool isSelected(const std::string &operation, const Options &options) {
+        return operation.find(options.filter) != std::string::npos;
+    }
+
+    template<class T>
+    void benchIntegers(const Options &options, std::vector<Result> &results) {
+        const std::string pieceType = pieceTypeName<T>();
+        const std::size_t pieceSize = sizeof(T) * 8;
+
+        std::mt19937_64 generator(pieceSize);
+
+        for (std::size_t size: sizesUpTo(LINEAR_LIMIT / pieceSize, options)) {
+            BigIntBackend<T> first = random<T>(size, generator), second = random<T>(size, generator);
+
+            // Operands differ only in the lowest piece, so comparison scans all of them.
+            BigIntBackend<T> similar = first;
+            ++similar.accessPieces().front();
+
+            if (isSelected("add", options)) {
+                results.push_back(measure("add", pieceType, size, options, [&]() {
+                    BigIntBackend<T> result = first;
+                    result.add(second);
+
+                    return result.accessPieces().size();
+                }));
+            }
+
+            if (isSelected("sub", options)) {
+                results.push_back(measure("sub", pieceType, size, options, [&]() {
+                    BigIntBackend<T> result = first;
+                    result.subtract(second);
+
+                    return result.accessPieces().size();
+                }));
+            }
+
+            if (isSelected("compare", options)) {
+                results.push_back(measure("compare", pieceType, size, options, [&]() {
+                    return static_cast<std::size_t>(first.compare(similar) + 1);
+                }));
+            }
+        }
+
+        for (std::size_t size: sizesUpTo(MULTIPLICATION_LIMIT / pieceSize, options)) {
+            BigIntBackend<T> first = random<T>(size, generator), second = random<T>(size, generator);
+
+            if (isSelected("mul", options)) {
+                results.push_back(measure("mul", pieceType, size, options, [&]() {
+                    BigIntBackend<T> result = first;
+                    result.multiply(second);
+
+                    return result.accessPieces().size();
+                }));
+            }
+        }
+
+        // Dividend is twice as long as divisor, size is length of divisor.
+        for (std::size_t size: sizesUpTo(DIVISION_LIMIT / pieceSize, options)) {
+            BigIntBackend<T> dividend = random<T>(2 * size, generator), divisor = random<T>(size, generator);
+
+            if (isSelected("div", options)) {
+                results.push_back(measure("div", pieceType, size, options, [&]() {
+                    BigIntBackend<T> result = dividend;
+                    result.divide(divisor);
+
+                    return result.accessPieces().size();
+                }));
+            }
+
+            // Remainder replaces the value, as BigInt::operator%= does, and the quotient is dropped.
+            if (isSelected("mod", options)) {
+                results.push_back(measure("mod", pieceType, size, options, [&]() {
+                    BigIntBackend<T> result = dividend;
+                    result = result.divide(divisor);
+
+                    return result.accessPieces().size();
+                }));
+            }
+        }
+
+        for (std::size_t size: sizesUpTo(CONVERSION_LIMIT / pieceSize, options)) {
+            BigIntBackend<T> value = random<T>(size, generator);
+            std::string text = value.toString();
+
+            if (isSelected("parse", options)) {
+                results.push_back(measure("parse", pieceType, size, options, [&]() {
+                    return parseBigInt<T>(text).accessPieces().size();
+                }));
+            }
+
+            if (isSelected("toString", options)) {
+                results.push_back(measure("toString", pieceType, size, options, [&]() {
+                    return value.toString().size();
+                }));
+            }
+        }
+    }
+
+    // BigFloat is built on PieceType only, size is precision in pieces.
+    void benchFloats(const Options &options, std::vector<Result> &results) {
+        const std::string pieceType = pieceTypeName<PieceType>();
+
+        for (std::size_t size: sizesUpTo(FLOAT_LIMIT, options)) {
+            // Single piece is too coarse for series of pi and sin to converge.
+            size = std::max(size, static_cast<std::size_t>(2));
+            PrecisionScope scope(size);
+
+            BigFloat two(2), third = BigFloat(1) / BigFloat(3), threeQuarters = BigFloat(3) / BigFloat(4);
+            int digits = BigFloat().getDecimalPrecision();
+
+            if (isSelected("sqrt", options)) {
+                results.push_back(measure("sqrt", pieceType, size, options, [&]() {
+                    return sqrt(two).getPrecision();
+                }));
+            }
+
+            if (isSelected("sin", options)) {
+                results.push_back(measure("sin", pieceType, size, options, [&]() {
+                    return sin(third).getPrecision();
+                }));
+            }
+
+            if (isSelected("ln", options)) {
+                results.push_back(measure("ln", pieceType, size, options, [&]() {
+                    return ln(threeQuarters).getPrecision();
+                }));
+            }
+
+            if (isSelected("pi", options)) {
+                results.push_back(measure("pi", pieceType, size, options, [&]() {
+                    return pi(digits).getPrecision();
+                }));
+            }
+        }
+
+        // Size is the argument of factorial.
+        for (std::size_t size: sizesUpTo(FACTORIAL_LIMIT, options)) {
+            if (isSelected("factorial", options)) {
+                results.push_back(measure("factorial", pieceType, size, options, [&]() {
+                    return factorial(size).getPrecision();
+                }));
+            }
+        }
+    }
+
+    void printUsage() {
+        std::cerr << "Usage: big_numbers_bench [--format csv|json] [--filter OPERATION] [--max-limbs COUNT] "
+                     "[--min-time SECONDS]" << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+
+        if (i + 1 == argc) {
+            printUsage();
+            return 1;
+        }
+
+        std::string value = argv[++i];
+
+        if (argument == "--format" && (value == "csv" || value == "json")) {
+            options.isJson = value == "json";
+        } else if (argument == "--filter") {
+            options.filter = value;
+        } else if (argument == "--max-limbs") {
+            options.maxLimbs = std::stoul(value);
+        } else if (argument == "--min-time") {
+            options.minTime = std::stod(value);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+
+    benchIntegers<uint8_t>(options, results);
+    benchIntegers<uint16_t>(options, results);
+#ifdef __SIZEOF_INT128__
+    benchIntegers<uint64_t>(options, results);
+#endif
+    benchFloats(options, results);
+
+    if (options.isJson) {
+        writeJson(std::cout, results);
+    } else {
+        writeCsv(std::cout, results);
+    }
+
+    return 0;
+}
@@ -1,36 +1,22 @@
 #include "BigFloat.h"
 
-#include "BigFloatBackend.h"
+#include "BigFloatImplementation.h"
 #include "ParsingUtils.h"
-#include "config.h"
 
 #include <cmath>
 
 namespace BigNumbers {
-    class BigFloat::Implementation {
-    public:
-        std::size_t precision;
-        BigFloatBackend<PieceType> backend;
+    std::atomic<std::size_t> BigFloat::Implementation::defaultPrecision(8);
 
-        static std::size_t defaultPrecision;
+    thread_local std::size_t BigFloat::Implementation::scopedPrecision = 0;
 
-        Implementation() : precision(defaultPrecision), backend() {
+    thread_local RoundingMode BigFloat::Implementation::roundingMode = RoundingMode::NEAREST_EVEN;
 
-        }
-
-        explicit Implementation(const BigFloatBackend<PieceType> &other) : precision(defaultPrecision), backend(other) {
-
-        }
-
-        explicit Implementation(const BigIntBackend<PieceType> &other) : precision(defaultPrecision), backend(other) {
-
-        }
-    };
-
-    std::size_t BigFloat::Implementation::defaultPrecision = 8;
+    thread_local bool BigFloat::Implementation::isInexact = false;
 
     BigFloat &BigFloat::operator+=(const BigFloat &addend) {
-        implementation->backend.add(addend.implementation->backend);
+        Implementation::flag(implementation->backend.add(addend.implementation->backend,
+                                                         implementation->getRounding()));
 
         return *this;
     }
@@ -65,6 +51,18 @@ namespace BigNumbers {
 
     }
 
+    BigFloat::BigFloat(unsigned char *bytes, std::size_t size, std::size_t fractionSize) : implementation(nullptr) {
+        // Fraction is padded with zero bytes to whole pieces, so the point lies between pieces of mantissa.
+        std::size_t fractionPieceCount = (fractionSize + sizeof(PieceType) - 1) / sizeof(PieceType);
+        std::vector<unsigned char> paddedBytes(fractionPieceCount * sizeof(PieceType) - fractionSize, 0);
+        paddedBytes.insert(paddedBytes.end(), bytes, bytes + size);
+
+        BigIntBackend<PieceType> mantissa(paddedBytes.data(), paddedBytes.size());
+        auto exponent = static_cast<int32_t>(mantissa.accessPieces().size() - fractionPieceCount) - 1;
+
+        implementation = new Implementation(BigFloatBackend<PieceType>(mantissa, exponent));
+    }
+
     BigFloat BigFloat::epsilon(std::size_t precision) {
         BigFloat epsilon;
         epsilon.implementation = new Implementation(BigFloatBackend<PieceType>::epsilon(precision));
@@ -74,6 +72,15 @@ namespace BigNumbers {
 
     void BigFloat::setPrecision(std::size_t precision) {
         implementation->precision = precision;
+        implementation->bitPrecision = precision * Implementation::PIECE_BITS;
+        implementation->isSignificant = false;
+    }
+
+    void BigFloat::setBitPrecision(std::size_t bitPrecision) {
+        implementation->precision = (bitPrecision + 2 * Implementation::PIECE_BITS - 2) / Implementation::PIECE_BITS;
+        implementation->bitPrecision = bitPrecision;
+        implementation->isSignificant = true;
+        Implementation::flag(implementation->backend.round(implementation->getRounding()));
     }
 
     BigFloat::operator BigInt() const {
@@ -108,7 +115,8 @@ namespace BigNumbers {
     }
 
     BigFloat &BigFloat::operator-=(const BigFloat &subtrahend) {
-        implementation->backend.subtract(subtrahend.implementation->backend);
+        Implementation::flag(implementation->backend.subtract(subtrahend.implementation->backend,
+                                                              implementation->getRounding()));
         return *this;
     }
 
@@ -131,7 +139,8 @@ namespace BigNumbers {
     }
 
     BigFloat &BigFloat::operator*=(const BigFloat &multiplicand) {
-        implementation->backend.multiply(multiplicand.implementation->backend, implementation->precision);
+        Implementation::flag(implementation->backend.multiply(multiplicand.implementation->backend,
+                                                              implementation->getRounding()));
         return *this;
     }
 
@@ -142,7 +151,8 @@ namespace BigNumbers {
     }
 
     BigFloat &BigFloat::operator/=(const BigFloat &divisor) {
-        implementation->backend.divide(divisor.implementation->backend, implementation->precision);
+        Implementation::flag(implementation->backend.divide(divisor.implementation->backend,
+                                                            implementation->getRounding()));
         return *this;
     }
 
@@ -183,7 +193,11 @@ namespace BigNumbers {
     }
 
     std::ostream &operator<<(std::ostream &out, const BigFloat &value) {
-        out << value.implementation->backend.toString(out.precision(), (out.flags() & std::ostream::fixed));
+        if ((out.flags() & std::ostream::floatfield) == std::ostream::scientific) {
+            out << value.implementation->backend.toScientificString(out.precision());
+        } else {
+            out << value.implementation->backend.toString(out.precision(), (out.flags() & std::ostream::fixed));
+        }
 
         return out;
     }
@@ -192,10 +206,16 @@ namespace BigNumbers {
         std::string source;
         input >> source;
 
-        BigFloatBackend<PieceType> backend = parseBigFloat<PieceType>(source, input.precision());
+        // Active precision scope overrides precision of the stream.
+        std::size_t precision = BigFloat::Implementation::scopedPrecision;
+        if (precision == 0) {
+            precision = static_cast<std::size_t>(input.precision());
+        }
+
+        BigFloatBackend<PieceType> backend = parseBigFloat<PieceType>(source, precision);
         delete value.implementation;
         value.implementation = new BigFloat::Implementation(backend);
-        value.setPrecision(input.precision());
+        value.setPrecision(precision);
 
         return input;
     }
@@ -206,22 +226,23 @@ namespace BigNumbers {
         return *this;
     }
 
-    int32_t scale05_1(BigFloat &value) {
-        int32_t correction = value.implementation->backend.getExponent() + 1;
-
-        value.implementation->backend.setExponent(-1);
+    BigFloat sqrt(const BigFloat &value) {
+        BigFloat root = value;
 
-        int32_t additional = 0;
+        // Non-positive values are returned as they are.
+        if (root > 0) {
+            BigFloat::Implementation::flag(root.implementation->backend.sqrt(root.implementation->getRounding()));
+        }
 
-        BigFloat half(0.5);
-        BigFloat one(1);
+        return root;
+    }
 
-        while (value < half) {
-            value << 1;
-            ++additional;
-        }
+    int32_t scale05_1(BigFloat &value) {
+        // Leading bit is moved right below the point by single shift.
+        auto correction = static_cast<int32_t>(value.implementation->backend.getBitExponent() + 1);
+        value.implementation->backend.scaleBits(-correction);
 
-        return correction * 8 * static_cast<int32_t>(sizeof(PieceType)) - additional;
+        return correction;
     }
 
     void BigFloat::setDefaultPrecision(std::size_t precision) {
@@ -229,15 +250,57 @@ namespace BigNumbers {
     }
 
     std::size_t BigFloat::getDefaultPrecision() {
-        return Implementation::defaultPrecision;
+        return Implementation::currentPrecision();
     }
 
     int BigFloat::getDecimalPrecision() {
-        return static_cast<int>(static_cast<double>(getPrecision() * 8 * sizeof(PieceType)) * std::log10(2.0));
+        return static_cast<int>(static_cast<double>(getBitPrecision()) * std::log10(2.0));
     }
 
     std::size_t BigFloat::getPrecision() const {
-        return implementation == nullptr ? Implementation::defaultPrecision : implementation->precision;
+        return implementation == nullptr ? Implementation::currentPrecision() : implementation->precision;
+    }
+
+    std::size_t BigFloat::getBitPrecision() const {
+        return implementation == nullptr ? Implementation::currentPrecision() * Implementation::PIECE_BITS
+                                         : implementation->bitPrecision;
+    }
+
+    PrecisionScope::PrecisionScope(std::size_t precision) :
+            previousPrecision(BigFloat::Implementation::scopedPrecision) {
+        if (precision == 0) {
+            throw std::logic_error("Precision must be positive.");
+        }
+
+        BigFloat::Implementation::scopedPrecision = precision;
+    }
+
+    PrecisionScope::~PrecisionScope() {
+        BigFloat::Implementation::scopedPrecision = previousPrecision;
+    }
+
+    void BigFloat::setRoundingMode(RoundingMode mode) {
+        Implementation::roundingMode = mode;
+    }
+
+    RoundingMode BigFloat::getRoundingMode() {
+        return Implementation::roundingMode;
+    }
+
+    bool BigFloat::isInexact() {
+        return Implementation::isInexact;
+    }
+
+    void BigFloat::clearInexact() {
+        Implementation::isInexact = false;
+    }
+
+    RoundingScope::RoundingScope(RoundingMode mode) : previousMode(BigFloat::getRoundingMode()) {
+        BigFloat::setRoundingMode(mode);
+    }
+
+    RoundingScope::~RoundingScope() {
+        BigFloat::setRoundingMode(previousMode);
     }
 }
 
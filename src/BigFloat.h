@@ -2,6 +2,7 @@
 #define BIG_NUMBERS_BIGFLOAT_H
 
 #include "BigInt.h"
+#include "RoundingMode.h"
 
 #include <sstream>
 #include <iomanip>
@@ -14,6 +15,10 @@ namespace BigNumbers {
     private:
         class Implementation;
 
+        friend class PrecisionScope;
+
+        friend class BigInterval;
+
         Implementation *implementation;
     public:
         BigFloat();
@@ -35,6 +40,9 @@ namespace BigNumbers {
 
         BigFloat(unsigned char *bytes, std::size_t size);
 
+        // Little-endian two's complement bytes, lowest fractionSize of which lie after the point.
+        BigFloat(unsigned char *bytes, std::size_t size, std::size_t fractionSize);
+
         ~BigFloat();
 
         explicit operator BigInt() const;
@@ -87,10 +95,30 @@ namespace BigNumbers {
 
         void setPrecision(std::size_t precision);
 
+        // Sets process-wide default precision. Threads with active PrecisionScope keep their own one.
         static void setDefaultPrecision(std::size_t precision);
 
         std::size_t getPrecision() const;
 
+        // Precision in bits rather than in whole pieces. Results keep this many significant bits, counted from their
+        // leading bit, and are rounded in current rounding mode. Precision in pieces covers these bits at any position
+        // of the leading bit.
+        void setBitPrecision(std::size_t bitPrecision);
+
+        std::size_t getBitPrecision() const;
+
+        // Mode, which operations of current thread round their results with. Results of arithmetic operations and sqrt
+        // are rounded correctly, default mode rounds to nearest.
+        static void setRoundingMode(RoundingMode mode);
+
+        static RoundingMode getRoundingMode();
+
+        // Whether an operation of current thread rounded its result since the flag was cleared.
+        static bool isInexact();
+
+        static void clearInexact();
+
+        // Precision of innermost PrecisionScope of current thread, or process-wide default precision.
         static std::size_t getDefaultPrecision();
 
         static BigFloat epsilon(std::size_t precision);
@@ -98,6 +126,40 @@ namespace BigNumbers {
         int getDecimalPrecision();
 
         friend int32_t scale05_1(BigFloat &value);
+
+        friend BigFloat sqrt(const BigFloat &value);
+    };
+
+    // Overrides default precision of current thread until the end of scope. New values, values read by operator>>
+    // and math functions use this precision, so threads can compute at different precisions independently. Scopes
+    // may be nested.
+    class PrecisionScope {
+    public:
+        explicit PrecisionScope(std::size_t precision);
+
+        PrecisionScope(const PrecisionScope &) = delete;
+
+        PrecisionScope &operator=(const PrecisionScope &) = delete;
+
+        ~PrecisionScope();
+
+    private:
+        std::size_t previousPrecision;
+    };
+
+    // Overrides rounding mode of current thread until the end of scope.
+    class RoundingScope {
+    public:
+        explicit RoundingScope(RoundingMode mode);
+
+        RoundingScope(const RoundingScope &) = delete;
+
+        RoundingScope &operator=(const RoundingScope &) = delete;
+
+        ~RoundingScope();
+
+    private:
+        RoundingMode previousMode;
     };
 }
 
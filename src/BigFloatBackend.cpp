@@ -5,11 +5,21 @@
 #include <cmath>
 #include <algorithm>
 
+#include "DecimalUtils.h"
+#include "DivisionUtils.h"
 #include "IsomorphicMath.h"
+#include "NumberTheoryUtils.h"
+#include "Stats.h"
 #include "VectorUtils.h"
 #include "config.h"
 
 namespace BigNumbers {
+    // Pieces after the point, which hold given amount of fraction bits.
+    template<class T>
+    std::size_t getFractionWidth(std::size_t fractionBits) {
+        return (fractionBits + sizeof(T) * 8 - 1) / (sizeof(T) * 8);
+    }
+
     template<class T>
     BigFloatBackend<T>::BigFloatBackend():
             mantissa(BigIntBackend<T>{}), exponent(0) {
@@ -33,57 +43,140 @@ namespace BigNumbers {
     }
 
     template<class T>
-    void BigFloatBackend<T>::add(BigFloatBackend<T> addend) {
-        int32_t outputExponent = std::max(exponent, addend.exponent);
+    void BigFloatBackend<T>::add(const BigFloatBackend<T> &addend, std::size_t precision) {
+        addAligned(addend, false, precision);
 
-        bool isMantissaNegative = mantissa.getSign();
-        bool isAddendNegative = addend.mantissa.getSign();
+        if (precision != EXACT) {
+            trim(precision);
+        }
+    }
 
-        if (isMantissaNegative) {
-            mantissa.negate();
+    template<class T>
+    void BigFloatBackend<T>::subtract(const BigFloatBackend<T> &subtrahend, std::size_t precision) {
+        addAligned(subtrahend, true, precision);
+
+        if (precision != EXACT) {
+            trim(precision);
         }
+    }
 
-        if (isAddendNegative) {
-            addend.mantissa.negate();
+    template<class T>
+    bool BigFloatBackend<T>::add(const BigFloatBackend<T> &addend, const Rounding &rounding) {
+        return round(rounding, addAligned(addend, false, getFractionWidth<T>(rounding.fractionBits)));
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::subtract(const BigFloatBackend<T> &subtrahend, const Rounding &rounding) {
+        return round(rounding, addAligned(subtrahend, true, getFractionWidth<T>(rounding.fractionBits)));
+    }
+
+    // Values are mantissa * base^lowExponent, which does not change, when mantissa is negated or normalized. Mantissa
+    // -1 has no pieces, but takes place of one.
+    template<class T>
+    int32_t getLowExponent(const BigIntBackend<T> &mantissa, int32_t exponent) {
+        return exponent + 1 - static_cast<int32_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1));
+    }
+
+    // Piece of two's complement mantissa at given position, where its lowest piece lies at lowExponent. Positions
+    // below it are zero, positions above it are filled with sign.
+    template<class T>
+    T getPieceAt(const BigIntBackend<T> &mantissa, int64_t lowExponent, int64_t position) {
+        if (position < lowExponent) {
+            return 0;
         }
 
-        extendBack(mantissa.accessPieces(), (T) 0, IsomorphicMath::delta(exponent, outputExponent));
-        extendBack(addend.mantissa.accessPieces(), (T) 0, IsomorphicMath::delta(addend.exponent, outputExponent));
+        const std::vector<T> &pieces = mantissa.accessPieces();
+        auto index = static_cast<std::size_t>(position - lowExponent);
+
+        return index < pieces.size() ? pieces[index] : mantissa.getFillValue();
+    }
 
-        std::size_t width = std::max(mantissa.accessPieces().size(), addend.mantissa.accessPieces().size());
+    // Lowest position, which trim keeps for value with top piece at given position.
+    inline int64_t getLowestKept(int64_t topExponent, std::size_t precision) {
+        return topExponent >= -1 ? -static_cast<int64_t>(precision) : topExponent + 1 - static_cast<int64_t>(precision);
+    }
 
-        extendFront(mantissa.accessPieces(), (T) 0, IsomorphicMath::delta(width, mantissa.accessPieces().size()));
-        extendFront(addend.mantissa.accessPieces(), (T) 0,
-                    IsomorphicMath::delta(width, addend.mantissa.accessPieces().size()));
+    template<class T>
+    bool BigFloatBackend<T>::addAligned(const BigFloatBackend<T> &addend, bool isSubtraction, std::size_t precision) {
+        BIG_NUMBERS_COUNT(FLOAT_ADDITIONS, 1);
 
-        if (isMantissaNegative) {
-            mantissa.negate();
+        if (addend.mantissa.accessPieces().empty() && !addend.mantissa.getSign()) {
+            return false;
+        }
+
+        int64_t lowExponent = getLowExponent(mantissa, exponent);
+        int64_t addendLowExponent = getLowExponent(addend.mantissa, addend.exponent);
+
+        // Extra piece above both operands receives carry and sign of result. Pieces are stored from a guard piece
+        // below the ones, which are kept, when result stays at top of operands.
+        int64_t top = std::max(lowExponent + std::max<int64_t>(mantissa.accessPieces().size(), 1),
+                               addendLowExponent + std::max<int64_t>(addend.mantissa.accessPieces().size(), 1));
+        int64_t lowest = std::min(lowExponent, addendLowExponent);
+        int64_t start = precision == EXACT ? lowest : std::max(lowest, getLowestKept(top - 1, precision) - 1);
+
+        // Subtrahend is added as its inverted pieces plus one at its lowest piece, positions below it stay zero.
+        T mask = isSubtraction ? std::numeric_limits<T>::max() : 0;
+        T carry = 0;
+
+        auto addPieces = [&](int64_t position) {
+            T first = getPieceAt(mantissa, lowExponent, position);
+            T second = position < addendLowExponent
+                       ? 0 : getPieceAt(addend.mantissa, addendLowExponent, position) ^ mask;
+            T increment = isSubtraction && position == addendLowExponent;
+
+            T sum = first + second;
+            T nextCarry = sum < first;
+            T result = sum + carry + increment;
+            carry = nextCarry | (result < sum);
+
+            return result;
+        };
+
+        // Pieces below precision are not stored, only their carry and whether they are zero.
+        bool isAboveStored = false;
+        for (int64_t position = lowest; position < start; ++position) {
+            isAboveStored = addPieces(position) != 0 || isAboveStored;
         }
 
-        if (isAddendNegative) {
-            addend.mantissa.negate();
+        std::vector<T> pieces;
+        pieces.reserve(static_cast<std::size_t>(top - start + 1));
+
+        for (int64_t position = start; position <= top; ++position) {
+            pieces.push_back(addPieces(position));
         }
 
-        mantissa.add(addend.mantissa);
+        bool isNegative = pieces.back() >> (sizeof(T) * 8 - 1);
 
-        outputExponent += mantissa.accessPieces().size() - width;
+        BigIntBackend<T> sum(isNegative, std::move(pieces));
+        sum.normalize();
 
-        width = mantissa.accessPieces().size();
-        mantissa.normalize();
-        outputExponent -= width - mantissa.accessPieces().size();
-        trimFront(mantissa.accessPieces(), mantissa.getFillValue());
+        std::vector<T> &sumPieces = sum.accessPieces();
+        auto lowZeroEnd = std::find_if(sumPieces.begin(), sumPieces.end(), [](T piece) {
+            return piece != 0;
+        });
+        bool isZero = lowZeroEnd == sumPieces.end() && !isNegative;
 
-        if (mantissa.accessPieces().empty()) {
+        // Cancellation moved top piece so low, that skipped pieces are needed. Its position is unknown, when kept pieces
+        // are only fill ones.
+        if (start > lowest && (sumPieces.empty() || getLowestKept(start + std::max<int64_t>(sumPieces.size(), 1) - 1,
+                                                       precision) <= start)) {
+            return addAligned(addend, isSubtraction, EXACT);
+        }
+
+        if (isZero) {
+            mantissa = std::move(sum);
             exponent = 0;
-        } else {
-            exponent = outputExponent;
+            return false;
         }
-    }
 
-    template<class T>
-    void BigFloatBackend<T>::subtract(BigFloatBackend<T> subtrahend) {
-        subtrahend.negate();
-        add(subtrahend);
+        // Negative mantissa, which has only zero pieces, becomes -1 above them.
+        std::size_t lowZeroCount = lowZeroEnd - sumPieces.begin();
+        sumPieces.erase(sumPieces.begin(), lowZeroEnd);
+
+        exponent = static_cast<int32_t>(start + lowZeroCount + std::max<std::size_t>(sumPieces.size(), 1) - 1);
+        mantissa = std::move(sum);
+
+        return isAboveStored;
     }
 
     template<class T>
@@ -91,23 +184,22 @@ namespace BigNumbers {
         mantissa.negate();
     }
 
-    inline std::size_t getFractionWidth(std::size_t totalCount) {
-        return totalCount > 0 ? totalCount - 1 : 0;
-    }
-
     template<class T>
     void BigFloatBackend<T>::multiply(BigFloatBackend<T> multiplicand, std::size_t precision) {
-        std::size_t inputFractionWidth = getFractionWidth(mantissa.accessPieces().size())
-                                         + getFractionWidth(multiplicand.mantissa.accessPieces().size());
+        BIG_NUMBERS_COUNT(FLOAT_MULTIPLICATIONS, 1);
 
-        mantissa.multiply(multiplicand.mantissa);
-        exponent += multiplicand.exponent;
+        int32_t lowExponent = getLowExponent(mantissa, exponent) +
+                              getLowExponent(multiplicand.mantissa, multiplicand.exponent);
 
-        std::size_t resultFractionWidth = getFractionWidth(mantissa.accessPieces().size());
-        exponent += static_cast<int32_t>(resultFractionWidth - inputFractionWidth);
+        // Pieces, which trim keeps: integral ones, including possible carry into a new top piece, and fraction.
+        std::size_t width = std::max(0, exponent + multiplicand.exponent + 2) + precision;
+
+        auto dropped = static_cast<int32_t>(mantissa.multiplyHigh(multiplicand.mantissa, width));
 
         if (mantissa.accessPieces().empty()) {
             exponent = 0;
+        } else {
+            exponent = static_cast<int32_t>(mantissa.accessPieces().size()) - 1 + lowExponent + dropped;
         }
 
         trim(precision);
@@ -121,36 +213,56 @@ namespace BigNumbers {
     }
 
     template<class T>
-    bool isSufficientlyCloseToOne(BigFloatBackend<T> value, std::size_t mantissaWidth) {
-        value.subtract(BigFloatBackend<T>(BigIntBackend<T>(1), 0));
+    void BigFloatBackend<T>::divide(BigFloatBackend<T> divisor, std::size_t precision) {
+        BIG_NUMBERS_COUNT(FLOAT_DIVISIONS, 1);
 
-        if (value.getMantissa().getSign()) {
-            value.negate();
+        if (divisor.mantissa.compare(BigIntBackend<T>(0)) == 0) {
+            throw std::logic_error("Cannot divide by zero.");
         }
 
-        return value.compare(BigFloatBackend<T>::epsilon(mantissaWidth)) <= 0;
-    }
+        int32_t lowExponent = getLowExponent(mantissa, exponent);
+        int32_t divisorLowExponent = getLowExponent(divisor.mantissa, divisor.exponent);
 
-    template<class T>
-    void BigFloatBackend<T>::divide(BigFloatBackend<T> divisor, std::size_t precision) {
-        constexpr std::size_t MAX_ITER_COUNT = 100;
+        bool isNegative = mantissa.getSign() != divisor.mantissa.getSign();
 
-        exponent -= divisor.exponent + 1;
-        divisor.exponent = -1;
+        if (mantissa.getSign()) {
+            mantissa.negate();
+        }
 
-        BigFloatBackend<T> two((BigIntBackend<T>) 2, 0);
+        if (divisor.mantissa.getSign()) {
+            divisor.mantissa.negate();
+        }
 
-        auto factor = two;
-        factor.subtract(divisor);
+        mantissa.normalize();
+        divisor.mantissa.normalize();
 
-        for (std::size_t iter = 0; !isSufficientlyCloseToOne(factor, precision) && iter < MAX_ITER_COUNT; ++iter) {
-            multiply(factor, precision);
+        if (mantissa.accessPieces().empty()) {
+            exponent = 0;
+            return;
+        }
+
+        auto size = static_cast<int32_t>(mantissa.accessPieces().size());
+        auto divisorSize = static_cast<int32_t>(divisor.mantissa.accessPieces().size());
+
+        // Significant pieces of quotient, which trim keeps, and a guard piece.
+        int32_t quotientExponent = (lowExponent + size) - (divisorLowExponent + divisorSize);
+        std::size_t width = std::max(0, quotientExponent + 1) + precision + 1;
+
+        if (mantissa.accessPieces().size() > width + 1) {
+            lowExponent += size - static_cast<int32_t>(width + 1);
+            mantissa = topPieces(mantissa, width + 1);
+        }
 
-            divisor.multiply(factor, precision);
+        // 1 / divisor = x * base^-(width + divisorSize + divisorLowExponent), where x is the reciprocal.
+        lowExponent += static_cast<int32_t>(mantissa.multiplyHigh(reciprocal(divisor.mantissa, width), width));
+        exponent = static_cast<int32_t>(mantissa.accessPieces().size()) - 1 + lowExponent -
+                   static_cast<int32_t>(width) - divisorSize - divisorLowExponent;
 
-            factor = two;
-            factor.subtract(divisor);
+        if (isNegative) {
+            mantissa.negate();
         }
+
+        trim(precision);
     }
 
     template<class T>
@@ -163,6 +275,434 @@ namespace BigNumbers {
         }
     }
 
+    template<class T>
+    void BigFloatBackend<T>::trimBits(std::size_t fractionBits) {
+        std::size_t pieceWidth = sizeof(T) * 8;
+        std::size_t fractionWidth = getFractionWidth<T>(fractionBits);
+
+        trim(fractionWidth);
+
+        // Mantissa is shorter, than kept width, when its lowest piece lies above the last kept one.
+        std::vector<T> &pieces = mantissa.accessPieces();
+        std::size_t clearedBits = fractionWidth * pieceWidth - fractionBits;
+
+        if (clearedBits > 0 && pieces.size() == std::max(0, exponent + 1) + fractionWidth) {
+            pieces.front() &= static_cast<T>(std::numeric_limits<T>::max() << clearedBits);
+        }
+    }
+
+    // Multiplies non-negative value by base^shift, rounding down. Returns whether dropped pieces were not zero.
+    template<class T>
+    bool shiftPieces(BigIntBackend<T> &value, int64_t shift) {
+        if (shift >= 0) {
+            value.shiftLeft(static_cast<std::size_t>(shift) * sizeof(T) * 8);
+            return false;
+        }
+
+        std::vector<T> &pieces = value.accessPieces();
+        auto droppedEnd = pieces.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(-shift, pieces.size()));
+        bool isDroppedNonZero = std::any_of(pieces.begin(), droppedEnd, [](T piece) {
+            return piece != 0;
+        });
+
+        pieces.erase(pieces.begin(), droppedEnd);
+
+        return isDroppedNonZero;
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::round(const Rounding &rounding, bool isAboveStored) {
+        std::vector<T> &pieces = mantissa.accessPieces();
+
+        if (pieces.empty()) {
+            if (!mantissa.getSign()) {
+                return false;
+            }
+
+            // Mantissa -1 gets its fill piece, so that it has a piece to round.
+            pieces.push_back(std::numeric_limits<T>::max());
+        }
+
+        std::size_t pieceWidth = sizeof(T) * 8;
+        auto signedPieceWidth = static_cast<int64_t>(pieceWidth);
+
+        // Last kept piece holds the lowest kept bit, bits below it are cleared.
+        int64_t lowBit = getLowestKeptBit(rounding, isAboveStored);
+        int64_t lowExponent = lowBit >= 0 ? lowBit / signedPieceWidth
+                                          : -((signedPieceWidth - 1 - lowBit) / signedPieceWidth);
+        auto clearedBits = static_cast<std::size_t>(lowBit - lowExponent * signedPieceWidth);
+
+        // Mantissa is extended to the last kept piece: by fill pieces, when it lies above, or by zero pieces below, when
+        // it is needed.
+        if (lowExponent > exponent) {
+            pieces.insert(pieces.end(), static_cast<std::size_t>(lowExponent - exponent), mantissa.getFillValue());
+            exponent = static_cast<int32_t>(lowExponent);
+        }
+
+        // Value, which ends above the last kept piece, is exact.
+        int64_t lowStoredExponent = exponent + 1 - static_cast<int64_t>(pieces.size());
+        if (lowStoredExponent > lowExponent) {
+            if (!isAboveStored) {
+                mantissa.normalize();
+                exponent = static_cast<int32_t>(lowStoredExponent) +
+                           static_cast<int32_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1;
+                return false;
+            }
+
+            pieces.insert(pieces.begin(), static_cast<std::size_t>(lowStoredExponent - lowExponent), 0);
+            lowStoredExponent = lowExponent;
+        }
+
+        auto droppedWidth = static_cast<std::size_t>(lowExponent - lowStoredExponent);
+
+        // Dropped part is compared with half of the last kept bit: its top bit is the half and the other ones are rest.
+        bool isHalf = false;
+        bool isRest = isAboveStored;
+        std::size_t restWidth = droppedWidth;
+
+        if (clearedBits > 0) {
+            T half = static_cast<T>(1) << (clearedBits - 1);
+            T lowBits = pieces[droppedWidth] & static_cast<T>(half | (half - 1));
+
+            isHalf = (lowBits & half) != 0;
+            isRest = isRest || (lowBits & static_cast<T>(half - 1)) != 0;
+            pieces[droppedWidth] ^= lowBits;
+        } else if (droppedWidth > 0) {
+            T guard = pieces[droppedWidth - 1];
+
+            isHalf = (guard >> (pieceWidth - 1)) != 0;
+            isRest = isRest || static_cast<T>(guard << 1) != 0;
+            --restWidth;
+        }
+
+        isRest = isRest || std::any_of(pieces.begin(), pieces.begin() + restWidth, [](T piece) {
+            return piece != 0;
+        });
+
+        // Truncation of two's complement mantissa rounds down, other modes add the last kept bit to it.
+        bool isOdd = ((pieces[droppedWidth] >> clearedBits) & 1) != 0;
+        bool isInexact = isHalf || isRest;
+        bool isIncremented = false;
+
+        if (rounding.mode == RoundingMode::NEAREST_EVEN) {
+            isIncremented = isHalf && (isRest || isOdd);
+        } else if (rounding.mode == RoundingMode::TOWARD_ZERO) {
+            isIncremented = isInexact && mantissa.getSign();
+        } else if (rounding.mode == RoundingMode::UP) {
+            isIncremented = isInexact;
+        }
+
+        pieces.erase(pieces.begin(), pieces.begin() + droppedWidth);
+
+        if (isIncremented) {
+            mantissa.add(BigIntBackend<T>(false, {static_cast<T>(static_cast<T>(1) << clearedBits)}));
+        }
+
+        mantissa.normalize();
+
+        if (mantissa.accessPieces().empty() && !mantissa.getSign()) {
+            exponent = 0;
+        } else {
+            exponent = static_cast<int32_t>(lowExponent) +
+                       static_cast<int32_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1;
+        }
+
+        return isInexact;
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::isRoundingAmbiguous(const Rounding &rounding, std::size_t errorBits) const {
+        const std::vector<T> &pieces = mantissa.accessPieces();
+
+        std::size_t pieceWidth = sizeof(T) * 8;
+        int64_t droppedBits = getLowestKeptBit(rounding, false) -
+                              getLowExponent(mantissa, exponent) * static_cast<int64_t>(pieceWidth);
+
+        // No piece below the last kept one is stored.
+        if (droppedBits < static_cast<int64_t>(pieceWidth)) {
+            return true;
+        }
+
+        // Bits, which lie above the error and below the half of the last kept bit.
+        auto end = static_cast<std::size_t>(droppedBits - 1);
+        bool hasZero = false;
+        bool hasOne = false;
+
+        for (std::size_t bit = errorBits; bit < end && !(hasZero && hasOne); ++bit) {
+            if ((pieces[bit / pieceWidth] >> (bit % pieceWidth)) & 1) {
+                hasOne = true;
+            } else {
+                hasZero = true;
+            }
+        }
+
+        return !(hasZero && hasOne);
+    }
+
+    template<class T>
+    int64_t BigFloatBackend<T>::getLowestKeptBit(const Rounding &rounding, bool isAboveStored) const {
+        auto pieceWidth = static_cast<int64_t>(sizeof(T) * 8);
+        std::size_t fractionWidth = getFractionWidth<T>(rounding.fractionBits);
+        int64_t lowBit = getLowestKept(exponent, fractionWidth) * pieceWidth +
+                         static_cast<int64_t>(fractionWidth * sizeof(T) * 8 - rounding.fractionBits);
+
+        if (rounding.significantBits == EXACT) {
+            return lowBit;
+        }
+
+        int64_t lowExponent = getLowExponent(mantissa, exponent);
+        BigIntBackend<T> magnitude = mantissa;
+
+        if (magnitude.getSign()) {
+            magnitude.negate();
+        }
+
+        magnitude.normalize();
+
+        const std::vector<T> &pieces = magnitude.accessPieces();
+
+        if (pieces.empty()) {
+            return lowBit;
+        }
+
+        BigFloatBackend<T> leading(magnitude, static_cast<int32_t>(
+                lowExponent + static_cast<int64_t>(pieces.size()) - 1));
+        int64_t leadingBit = leading.getBitExponent();
+
+        // Dropped bits lie below every stored one, so magnitude of exact value is below the stored one by less than
+        // any of its bits. It has a lower leading bit only, when stored magnitude is a power of two.
+        bool isPowerOfTwo = (pieces.back() & static_cast<T>(pieces.back() - 1)) == 0 &&
+                            std::all_of(pieces.begin(), pieces.end() - 1, [](T piece) {
+                                return piece == 0;
+                            });
+
+        if (isAboveStored && mantissa.getSign() && isPowerOfTwo) {
+            --leadingBit;
+        }
+
+        return std::max(lowBit, leadingBit + 1 - static_cast<int64_t>(rounding.significantBits));
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::toMagnitude() {
+        bool isNegative = mantissa.getSign();
+        int32_t lowExponent = getLowExponent(mantissa, exponent);
+
+        if (isNegative) {
+            mantissa.negate();
+        }
+
+        mantissa.normalize();
+        exponent = mantissa.accessPieces().empty()
+                   ? 0 : lowExponent + static_cast<int32_t>(mantissa.accessPieces().size()) - 1;
+
+        return isNegative;
+    }
+
+    template<class T>
+    void BigFloatBackend<T>::applySign(bool isNegative) {
+        if (!isNegative || mantissa.accessPieces().empty()) {
+            return;
+        }
+
+        int32_t lowExponent = getLowExponent(mantissa, exponent);
+
+        mantissa.negate();
+        mantissa.normalize();
+        exponent = lowExponent + static_cast<int32_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1;
+    }
+
+    // Mode, which rounds magnitude of negative value the same way, as given mode rounds the value itself.
+    inline RoundingMode mirror(RoundingMode mode) {
+        if (mode == RoundingMode::UP) {
+            return RoundingMode::DOWN;
+        }
+
+        if (mode == RoundingMode::DOWN) {
+            return RoundingMode::UP;
+        }
+
+        return mode;
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::multiply(BigFloatBackend<T> multiplicand, const Rounding &rounding) {
+        BIG_NUMBERS_COUNT(FLOAT_MULTIPLICATIONS, 1);
+
+        bool isNegative = toMagnitude() != multiplicand.toMagnitude();
+
+        if (mantissa.accessPieces().empty() || multiplicand.mantissa.accessPieces().empty()) {
+            mantissa = BigIntBackend<T>();
+            exponent = 0;
+            return false;
+        }
+
+        int32_t lowExponent = getLowExponent(mantissa, exponent) +
+                              getLowExponent(multiplicand.mantissa, multiplicand.exponent);
+
+        // Kept pieces with carry into a new top piece, guard piece and pieces, which absorb error of short product.
+        std::size_t width = std::max(0, exponent + multiplicand.exponent + 2) +
+                            getFractionWidth<T>(rounding.fractionBits) + 4;
+
+        BigIntBackend<T> product = mantissa;
+        auto dropped = static_cast<int32_t>(product.multiplyHigh(multiplicand.mantissa, width));
+
+        std::swap(mantissa, product);
+        exponent = static_cast<int32_t>(mantissa.accessPieces().size()) - 1 + lowExponent + dropped;
+
+        // Short product is less than exact one by less than base^3 units of its lowest piece.
+        if (dropped > 0 && isRoundingAmbiguous(rounding, 3 * sizeof(T) * 8)) {
+            std::swap(mantissa, product);
+            mantissa.multiply(multiplicand.mantissa);
+            exponent = static_cast<int32_t>(mantissa.accessPieces().size()) - 1 + lowExponent;
+            dropped = 0;
+        }
+
+        bool isInexact = round({rounding.fractionBits, isNegative ? mirror(rounding.mode) : rounding.mode,
+                                rounding.significantBits}, dropped > 0);
+
+        applySign(isNegative);
+
+        return isInexact;
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::divide(BigFloatBackend<T> divisor, const Rounding &rounding) {
+        bool isNegative = toMagnitude() != divisor.toMagnitude();
+
+        BigFloatBackend<T> dividend = *this;
+        std::size_t fractionWidth = getFractionWidth<T>(rounding.fractionBits);
+
+        // Quotient with two guard pieces is within a couple units of its lowest piece.
+        divide(divisor, fractionWidth + 2);
+
+        if (mantissa.accessPieces().empty()) {
+            return false;
+        }
+
+        bool isAboveStored = false;
+
+        if (isRoundingAmbiguous(rounding, sizeof(T) * 8)) {
+            // Quotient is found exactly by integer division down to a piece, which lies below the kept ones.
+            int32_t lowExponent = std::min<int32_t>(getLowExponent(mantissa, exponent),
+                                                    getLowestKept(exponent, fractionWidth) - 2);
+
+            int32_t shift = getLowExponent(dividend.mantissa, dividend.exponent) -
+                            getLowExponent(divisor.mantissa, divisor.exponent) - lowExponent;
+
+            mantissa = std::move(dividend.mantissa);
+            isAboveStored = shiftPieces(mantissa, shift);
+
+            BigIntBackend<T> remainder = mantissa.divide(divisor.mantissa);
+            remainder.normalize();
+            mantissa.normalize();
+
+            isAboveStored = isAboveStored || !remainder.accessPieces().empty();
+            exponent = lowExponent + static_cast<int32_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1;
+        }
+
+        bool isInexact = round({rounding.fractionBits, isNegative ? mirror(rounding.mode) : rounding.mode,
+                                rounding.significantBits}, isAboveStored);
+
+        applySign(isNegative);
+
+        return isInexact;
+    }
+
+    template<class T>
+    bool BigFloatBackend<T>::sqrt(const Rounding &rounding) {
+        if (mantissa.getSign()) {
+            throw std::logic_error("Cannot take square root of negative value.");
+        }
+
+        toMagnitude();
+
+        if (mantissa.accessPieces().empty()) {
+            return false;
+        }
+
+        auto pieceWidth = static_cast<int64_t>(sizeof(T) * 8);
+
+        // Leading bit of root lies at half of the leading bit of value, both rounded down.
+        int64_t bitExponent = getBitExponent();
+        int64_t rootBitExponent = bitExponent >= 0 ? bitExponent / 2 : -((1 - bitExponent) / 2);
+        int64_t rootExponent = rootBitExponent >= 0 ? rootBitExponent / pieceWidth
+                                                    : -((pieceWidth - 1 - rootBitExponent) / pieceWidth);
+
+        // Root is found exactly by integer square root down to a guard piece below the kept ones.
+        int64_t lowExponent = getLowestKept(rootExponent, getFractionWidth<T>(rounding.fractionBits)) - 1;
+
+        bool isAboveStored = shiftPieces(mantissa, getLowExponent(mantissa, exponent) - 2 * lowExponent);
+
+        BigIntBackend<T> remainder;
+        mantissa = sqrtrem(mantissa, remainder);
+        remainder.normalize();
+        mantissa.normalize();
+
+        isAboveStored = isAboveStored || !remainder.accessPieces().empty();
+        exponent = static_cast<int32_t>(
+                lowExponent + static_cast<int64_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1);
+
+        return round(rounding, isAboveStored);
+    }
+
+    template<class T>
+    int64_t BigFloatBackend<T>::getBitExponent() const {
+        const std::vector<T> *pieces = &mantissa.accessPieces();
+        BigIntBackend<T> magnitude;
+
+        if (mantissa.getSign()) {
+            magnitude = mantissa;
+            magnitude.negate();
+            magnitude.normalize();
+            pieces = &magnitude.accessPieces();
+        }
+
+        std::size_t size = pieces->size();
+        while (size > 0 && (*pieces)[size - 1] == 0) {
+            --size;
+        }
+
+        if (size == 0) {
+            throw std::logic_error("Zero has no bit exponent.");
+        }
+
+        int64_t topBit = -1;
+        for (T top = (*pieces)[size - 1]; top != 0; top >>= 1) {
+            ++topBit;
+        }
+
+        auto topExponent = getLowExponent(mantissa, exponent) + static_cast<int64_t>(size) - 1;
+
+        return topExponent * static_cast<int64_t>(sizeof(T) * 8) + topBit;
+    }
+
+    template<class T>
+    void BigFloatBackend<T>::scaleBits(int64_t count) {
+        auto pieceWidth = static_cast<int64_t>(sizeof(T) * 8);
+
+        // Count is split into whole pieces, rounded down, and remaining left shift of bits.
+        int64_t pieceShift = count >= 0 ? count / pieceWidth : -((-count + pieceWidth - 1) / pieceWidth);
+        int64_t bitShift = count - pieceShift * pieceWidth;
+
+        if (mantissa.accessPieces().empty()) {
+            if (!mantissa.getSign()) {
+                return;
+            }
+
+            // Mantissa -1 gets its fill piece, so that shift changes it.
+            mantissa.accessPieces().push_back(std::numeric_limits<T>::max());
+        }
+
+        int64_t lowExponent = getLowExponent(mantissa, exponent) + pieceShift;
+
+        mantissa.shiftLeft(bitShift);
+        mantissa.normalize();
+
+        exponent = static_cast<int32_t>(
+                lowExponent + static_cast<int64_t>(std::max<std::size_t>(mantissa.accessPieces().size(), 1)) - 1);
+    }
+
     template<class T>
     BigFloatBackend<T>::BigFloatBackend(const BigIntBackend<T> &value):
             mantissa(value), exponent(value.accessPieces().size()) {
@@ -204,60 +744,78 @@ namespace BigNumbers {
         mantissa.shiftLeft(count);
     }
 
+    // Non-negative value mantissa * base^lowExponent times 10^decimalShift, rounded to integer with halves rounded up.
     template<class T>
-    std::string BigFloatBackend<T>::toString(std::size_t precision, bool fixed) const {
-        std::string output;
+    BigIntBackend<T> scaleToInteger(BigIntBackend<T> mantissa, int64_t lowExponent, int64_t decimalShift) {
+        std::size_t pieceWidth = sizeof(T) * 8;
 
-        BigFloatBackend<T> targetValue = *this;
+        if (decimalShift > 0) {
+            mantissa.multiply(powerOfTen<T>(static_cast<std::size_t>(decimalShift)));
+        }
 
-        if (targetValue.mantissa.getSign()) {
-            targetValue.negate();
+        if (lowExponent > 0) {
+            mantissa.shiftLeft(static_cast<std::size_t>(lowExponent) * pieceWidth);
+            lowExponent = 0;
         }
 
-        auto integralPart = static_cast<BigIntBackend<T>>(targetValue);
+        if (decimalShift < 0) {
+            BigIntBackend<T> divisor = powerOfTen<T>(static_cast<std::size_t>(-decimalShift));
+            divisor.shiftLeft(static_cast<std::size_t>(-lowExponent) * pieceWidth);
 
-        BigFloatBackend<T> fractionalPart = targetValue;
-        BigFloatBackend<T> integralAsFloat(integralPart);
-        fractionalPart.subtract(integralAsFloat);
+            BigIntBackend<T> remainder = divideByNewton(mantissa, divisor);
+            remainder.shiftLeft(1);
 
-        BigFloatBackend<T> ten(BigIntBackend<T>(10));
-        auto multiplicationPrecision = static_cast<std::size_t>(static_cast<double>(precision) / std::log10(2.0));
-        multiplicationPrecision = multiplicationPrecision / (sizeof(T) * 8) + 1;
+            if (remainder.compare(divisor) >= 0) {
+                mantissa.add(BigIntBackend<T>(1));
+            }
 
-        for (std::size_t i = 0; i <= precision; ++i) {
-            fractionalPart.multiply(ten, multiplicationPrecision);
+            return mantissa;
         }
 
-        auto fractionalPartValue = (BigIntBackend<T>) fractionalPart;
-        auto remainder = fractionalPartValue.divide(BigIntBackend<T>(10));
+        // Dropped pieces make at least a half, when the top bit of the highest of them is set.
+        auto droppedCount = static_cast<std::size_t>(-lowExponent);
+        const std::vector<T> &pieces = mantissa.accessPieces();
+        bool isHalf = droppedCount > 0 && droppedCount <= pieces.size() &&
+                      (pieces[droppedCount - 1] >> (pieceWidth - 1)) != 0;
 
-        std::string tempFractionString = fractionalPartValue.toString();
-        if (remainder.compare(BigIntBackend<T>(5)) >= 0) {
-            fractionalPartValue.add(BigIntBackend<T>(1));
+        dropPieces(mantissa, droppedCount);
+
+        if (isHalf) {
+            mantissa.add(BigIntBackend<T>(1));
         }
-        std::string fractionString = fractionalPartValue.toString();
 
-        if (fractionString.length() > tempFractionString.length()) {
-            fractionString.erase(fractionString.begin());
-            integralPart.add(BigIntBackend<T>(1));
+        return mantissa;
+    }
+
+    template<class T>
+    std::string BigFloatBackend<T>::toString(std::size_t precision, bool fixed) const {
+        BigFloatBackend<T> magnitude = *this;
+        bool isNegative = magnitude.toMagnitude();
+
+        // Value is scaled by 10^precision and rounded once, so that digits of the integer hold both of its parts.
+        BigIntBackend<T> scaled = scaleToInteger(magnitude.mantissa,
+                                                 getLowExponent(magnitude.mantissa, magnitude.exponent),
+                                                 static_cast<int64_t>(precision));
+
+        std::string integralString = toDecimalString(scaled);
+        if (integralString.length() <= precision) {
+            extendFront(integralString, '0', static_cast<int64_t>(precision + 1 - integralString.length()));
         }
 
-        extendFront(fractionString, '0', (int) precision - (int) fractionString.length());
+        std::string fractionString = integralString.substr(integralString.length() - precision);
+        integralString.erase(integralString.length() - precision);
 
         if (!fixed) {
             trimBack(fractionString, '0');
         }
 
-        bool fractionEmpty = fractionString.empty() ||
-                             std::all_of(fractionString.begin(), fractionString.end(), [](char character) {
-                                 return character == '0';
-                             });
+        std::string output;
 
-        if (mantissa.getSign() && (integralPart.compare(BigIntBackend<T>(0)) != 0 || !fractionEmpty)) {
+        if (isNegative && !scaled.accessPieces().empty()) {
             output += '-';
         }
 
-        output += integralPart.toString();
+        output += integralString;
         if (!fractionString.empty()) {
             output += '.';
             output += fractionString;
@@ -266,6 +824,60 @@ namespace BigNumbers {
         return output;
     }
 
+    template<class T>
+    std::string BigFloatBackend<T>::toScientificString(std::size_t precision) const {
+        BigFloatBackend<T> magnitude = *this;
+        bool isNegative = magnitude.toMagnitude();
+
+        std::string digits(precision + 1, '0');
+        int64_t decimalExponent = 0;
+
+        if (!magnitude.mantissa.accessPieces().empty()) {
+            int64_t lowExponent = getLowExponent(magnitude.mantissa, magnitude.exponent);
+
+            // Exponent is estimated from the leading bit and corrected, when rounded value gets one digit more or
+            // less, than it should have.
+            decimalExponent = static_cast<int64_t>(std::floor(static_cast<double>(magnitude.getBitExponent()) *
+                                                              std::log10(2.0)));
+
+            while (true) {
+                digits = toDecimalString(scaleToInteger(magnitude.mantissa, lowExponent,
+                                                        static_cast<int64_t>(precision) - decimalExponent));
+
+                if (digits.length() > precision + 1) {
+                    ++decimalExponent;
+                } else if (digits.length() < precision + 1) {
+                    --decimalExponent;
+                } else {
+                    break;
+                }
+            }
+        }
+
+        std::string output;
+
+        if (isNegative) {
+            output += '-';
+        }
+
+        output += digits.front();
+        if (precision > 0) {
+            output += '.';
+            output.append(digits, 1, precision);
+        }
+
+        // Exponent has at least two digits, same as for built-in floating types.
+        std::string exponentString = std::to_string(decimalExponent < 0 ? -decimalExponent : decimalExponent);
+        if (exponentString.length() < 2) {
+            exponentString.insert(exponentString.begin(), '0');
+        }
+
+        output += decimalExponent < 0 ? "e-" : "e+";
+        output += exponentString;
+
+        return output;
+    }
+
     template<class T>
     int BigFloatBackend<T>::compare(const BigFloatBackend<T> &other) const {
         if (mantissa.getSign() != other.mantissa.getSign()) {
@@ -286,7 +898,8 @@ namespace BigNumbers {
                 return 1;
             }
 
-            if (exponent > other.exponent) {
+            // Negative values with larger exponent are smaller.
+            if ((exponent > other.exponent) != mantissa.getSign()) {
                 return 1;
             }
 
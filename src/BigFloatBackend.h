@@ -1,7 +1,10 @@
 #ifndef BIG_NUMBERS_BIG_FLOAT_HPP
 #define BIG_NUMBERS_BIG_FLOAT_HPP
 
+#include <limits>
+
 #include "BigIntBackend.h"
+#include "RoundingMode.h"
 
 namespace BigNumbers {
     template<class T>
@@ -18,9 +21,42 @@ namespace BigNumbers {
 
         explicit operator BigIntBackend<T>() const;
 
-        void add(BigFloatBackend<T> addend);
+        // Precision of operations, which keep all pieces of result.
+        static constexpr std::size_t EXACT = std::numeric_limits<std::size_t>::max();
+
+        // Adds value, result is trimmed to given precision. Operands are aligned by offset of their pieces, only
+        // pieces, which are kept, are written.
+        void add(const BigFloatBackend<T> &addend, std::size_t precision = EXACT);
+
+        void subtract(const BigFloatBackend<T> &subtrahend, std::size_t precision = EXACT);
+
+        // Bits after the point, or after the leading piece of values below one, which results are rounded to, and
+        // direction of rounding. Significant bits, counted from the leading bit, limit results further, fraction bits
+        // then bound work and have to exceed them by a piece without a bit to cover values below one.
+        struct Rounding {
+            std::size_t fractionBits;
+            RoundingMode mode;
+            std::size_t significantBits;
+
+            Rounding(std::size_t fractionBits, RoundingMode mode, std::size_t significantBits = EXACT) :
+                    fractionBits(fractionBits), mode(mode), significantBits(significantBits) {
+
+            }
+        };
+
+        // Operations, which round exact result correctly. They return whether result differs from the exact one.
+        bool add(const BigFloatBackend<T> &addend, const Rounding &rounding);
+
+        bool subtract(const BigFloatBackend<T> &subtrahend, const Rounding &rounding);
+
+        bool multiply(BigFloatBackend<T> multiplicand, const Rounding &rounding);
+
+        bool divide(BigFloatBackend<T> divisor, const Rounding &rounding);
+
+        bool sqrt(const Rounding &rounding);
 
-        void subtract(BigFloatBackend<T> subtrahend);
+        // Rounds value, which is exact, or lies above it by less than a unit of its lowest piece.
+        bool round(const Rounding &rounding, bool isAboveStored = false);
 
         void negate();
 
@@ -34,17 +70,49 @@ namespace BigNumbers {
 
         void trim(std::size_t fractionWidth);
 
+        // Same as trim, but fraction width is counted in bits. Bits of the last kept piece beyond it are cleared.
+        void trimBits(std::size_t fractionBits);
+
+        // Position of the leading bit of magnitude, so that magnitude lies in [2^e, 2^(e + 1)). Value must not be zero.
+        int64_t getBitExponent() const;
+
+        // Multiplies value by 2^count.
+        void scaleBits(int64_t count);
+
         static BigFloatBackend<T> epsilon(std::size_t mantissaWidth);
 
         std::string toBinaryString() const;
 
+        // Decimal value with given amount of digits after the point, rounded half up. Trailing zeros are kept only
+        // in fixed notation.
         std::string toString(std::size_t precision, bool fixed) const;
 
+        // Decimal value in form d.ddde+xx with given amount of digits after the point.
+        std::string toScientificString(std::size_t precision) const;
+
         BigIntBackend<T> getMantissa() const;
 
         int32_t getExponent() const;
 
         void setExponent(int32_t);
+
+    private:
+        // Returns whether pieces below precision, which were not stored, are not zero.
+        bool addAligned(const BigFloatBackend<T> &addend, bool isSubtraction, std::size_t precision);
+
+        // Whether approximation of non-negative value, which has error below 2^errorBits units of its lowest piece,
+        // is too close to a point, where its rounding changes.
+        bool isRoundingAmbiguous(const Rounding &rounding, std::size_t errorBits) const;
+
+        // Position of the lowest bit, which rounding keeps. Leading bit is taken from exact value, which lies above
+        // stored one, when it is negative.
+        int64_t getLowestKeptBit(const Rounding &rounding, bool isAboveStored) const;
+
+        // Replaces value by its absolute value with normalized mantissa, returns whether it was negative.
+        bool toMagnitude();
+
+        // Negates magnitude, when it is a negative result, keeping mantissa normalized.
+        void applySign(bool isNegative);
     };
 }
 
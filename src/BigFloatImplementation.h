@@ -0,0 +1,68 @@
+#ifndef BIG_NUMBERS_BIGFLOATIMPLEMENTATION_H
+#define BIG_NUMBERS_BIGFLOATIMPLEMENTATION_H
+
+#include <atomic>
+
+#include "BigFloat.h"
+#include "BigFloatBackend.h"
+#include "config.h"
+
+// State of BigFloat, which is shared with types built on the same backend.
+
+namespace BigNumbers {
+    class BigFloat::Implementation {
+    public:
+        static constexpr std::size_t PIECE_BITS = 8 * sizeof(PieceType);
+
+        // Precision in pieces, which bounds work of operations, and in bits, which bounds their results. Bits are
+        // counted after the leading bit, when precision was set in bits, otherwise after the point, as pieces are.
+        std::size_t precision;
+        std::size_t bitPrecision;
+        bool isSignificant;
+        BigFloatBackend<PieceType> backend;
+
+        static std::atomic<std::size_t> defaultPrecision;
+
+        // Precision of innermost PrecisionScope of current thread, zero outside of scopes.
+        static thread_local std::size_t scopedPrecision;
+
+        static thread_local RoundingMode roundingMode;
+        static thread_local bool isInexact;
+
+        static std::size_t currentPrecision() {
+            return scopedPrecision != 0 ? scopedPrecision : defaultPrecision.load();
+        }
+
+        Implementation() : precision(currentPrecision()), bitPrecision(precision * PIECE_BITS), isSignificant(false),
+                           backend() {
+
+        }
+
+        explicit Implementation(const BigFloatBackend<PieceType> &other) : precision(currentPrecision()),
+                                                                            bitPrecision(precision * PIECE_BITS),
+                                                                            isSignificant(false), backend(other) {
+
+        }
+
+        explicit Implementation(const BigIntBackend<PieceType> &other) : precision(currentPrecision()),
+                                                                          bitPrecision(precision * PIECE_BITS),
+                                                                          isSignificant(false), backend(other) {
+
+        }
+
+        BigFloatBackend<PieceType>::Rounding getRounding() const {
+            if (isSignificant) {
+                return {bitPrecision + PIECE_BITS - 1, roundingMode, bitPrecision};
+            }
+
+            return {bitPrecision, roundingMode};
+        }
+
+        // Raises inexact flag, when operation rounded its result.
+        static void flag(bool isRounded) {
+            isInexact = isInexact || isRounded;
+        }
+    };
+}
+
+#endif //BIG_NUMBERS_BIGFLOATIMPLEMENTATION_H
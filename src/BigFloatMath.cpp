@@ -1,5 +1,6 @@
 #include "BigFloatMath.h"
 
+#include <map>
 #include <sstream>
 
 #include "IsomorphicMath.h"
@@ -72,32 +73,67 @@ namespace BigNumbers {
         return computedSine;
     }
 
-    BigFloat sqrt(const BigFloat &value) {
-        return IsomorphicMath::sqrt(value, BigFloat::epsilon(value.getPrecision() - 1));
+    BigFloat findNextPrime(const BigFloat &value) {
+        return findNextPrime(value, IsomorphicMath::DEFAULT_SIEVE_WINDOW, 0);
     }
 
-    BigFloat findNextPrime(const BigFloat &value) {
+    BigFloat findNextPrime(const BigFloat &value, std::size_t sieveWindow, unsigned threadCount) {
         BigInt casted = floor(value);
 
-        BigInt result = IsomorphicMath::findNextPrime(casted);
+        BigInt result = IsomorphicMath::findNextPrime(casted, sieveWindow, threadCount);
 
         return BigFloat(result);
     }
 
+    std::vector<BigFloat> findPrimesInRange(const BigFloat &from, const BigFloat &to) {
+        return findPrimesInRange(from, to, IsomorphicMath::DEFAULT_SIEVE_WINDOW);
+    }
+
+    std::vector<BigFloat> findPrimesInRange(const BigFloat &from, const BigFloat &to, std::size_t sieveWindow,
+                                            unsigned threadCount) {
+        std::vector<BigInt> primes = IsomorphicMath::findPrimesInRange(ceil(from), floor(to), sieveWindow,
+                                                                       threadCount);
+
+        std::vector<BigFloat> result;
+        result.reserve(primes.size());
+
+        for (const BigInt &prime: primes) {
+            result.emplace_back(prime);
+        }
+
+        return result;
+    }
+
     BigFloat factorial(std::size_t n) {
-        BigInt out = IsomorphicMath::factorial<BigInt>(n);
+        return BigFloat(IsomorphicMath::factorial<BigInt>(n));
+    }
 
-        std::cout << out << std::endl;
+    BigFloat doubleFactorial(std::size_t n) {
+        return BigFloat(IsomorphicMath::doubleFactorial<BigInt>(n));
+    }
 
-        return BigFloat(out);
+    BigFloat binomial(std::size_t n, std::size_t k) {
+        return BigFloat(IsomorphicMath::binomial<BigInt>(n, k));
     }
 
     BigFloat pow(const BigFloat &value, int power) {
         return IsomorphicMath::pow(value, power);
     }
 
+    BigFloat pow(const BigFloat &value, const BigInt &power) {
+        return IsomorphicMath::pow(value, power);
+    }
+
     BigFloat ln(BigFloat value) {
-        static const BigFloat bigFloatLn2 = IsomorphicMath::ln(BigFloat(2), true);
+        // ln(2) is cached separately for each thread and precision.
+        static thread_local std::map<std::size_t, BigFloat> ln2Cache;
+
+        auto cached = ln2Cache.find(BigFloat::getDefaultPrecision());
+        if (cached == ln2Cache.end()) {
+            cached = ln2Cache.emplace(BigFloat::getDefaultPrecision(), IsomorphicMath::ln(BigFloat(2), true)).first;
+        }
+
+        const BigFloat &bigFloatLn2 = cached->second;
 
         int32_t correction = scale05_1(value);
         BigFloat receivedResult = IsomorphicMath::ln(value);
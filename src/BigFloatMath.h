@@ -2,6 +2,9 @@
 #define BIG_NUMBERS_BIGFLOATMATH_H
 
 #include "BigFloat.h"
+#include "BigInt.h"
+
+#include <vector>
 
 namespace BigNumbers {
     BigFloat sin(BigFloat value);
@@ -10,10 +13,29 @@ namespace BigNumbers {
 
     BigFloat findNextPrime(const BigFloat &value);
 
+    // Same as findNextPrime, but sieves candidates in windows of given size and tests them on given amount of threads.
+    // Zero thread count means thread count of the shared pool, see setThreadCount.
+    BigFloat findNextPrime(const BigFloat &value, std::size_t sieveWindow, unsigned threadCount = 0);
+
+    // Finds all primes in range [from, to] in increasing order.
+    std::vector<BigFloat> findPrimesInRange(const BigFloat &from, const BigFloat &to);
+
+    std::vector<BigFloat> findPrimesInRange(const BigFloat &from, const BigFloat &to, std::size_t sieveWindow,
+                                            unsigned threadCount = 0);
+
     BigFloat factorial(std::size_t n);
 
+    // Product of all positive values up to n, which have the same parity as n.
+    BigFloat doubleFactorial(std::size_t n);
+
+    // Amount of ways to choose k items out of n, zero when k > n.
+    BigFloat binomial(std::size_t n, std::size_t k);
+
+    // Raises value to given power by sliding window exponentiation. Negative powers take one final reciprocal.
     BigFloat pow(const BigFloat &value, int power);
 
+    BigFloat pow(const BigFloat &value, const BigInt &power);
+
     BigFloat ln(BigFloat value);
 
     BigFloat pi(int digitsAfterDot);
@@ -93,10 +93,12 @@ namespace BigNumbers {
         auto byteArray = getBytes();
 
         if (byteArray.second - 1 > sizeof(Value)) {
+            delete[] byteArray.first;
             throw std::logic_error("Cannot cast BigIntBackend to given type - value is too big.");
         }
 
         std::memcpy(reinterpret_cast<unsigned char *>(&value), byteArray.first, byteArray.second - 1);
+        delete[] byteArray.first;
 
         return value;
     }
@@ -4,7 +4,10 @@
 #include <regex>
 #include <bitset>
 
+#include "DecimalUtils.h"
 #include "VectorUtils.h"
+#include "MagnitudeUtils.h"
+#include "Stats.h"
 #include "config.h"
 
 namespace BigNumbers {
@@ -18,6 +21,25 @@ namespace BigNumbers {
 
     }
 
+    template<class T>
+    BigIntBackend<T>::BigIntBackend(const BigIntBackend<T> &other): isNegative(other.isNegative), pieces(other.pieces) {
+        BIG_NUMBERS_COUNT_ALLOCATION(pieces.capacity() * sizeof(T));
+    }
+
+    template<class T>
+    BigIntBackend<T> &BigIntBackend<T>::operator=(const BigIntBackend<T> &other) {
+        std::size_t capacity = pieces.capacity();
+
+        isNegative = other.isNegative;
+        pieces = other.pieces;
+
+        if (pieces.capacity() != capacity) {
+            BIG_NUMBERS_COUNT_ALLOCATION(pieces.capacity() * sizeof(T));
+        }
+
+        return *this;
+    }
+
 //    template<class T>
 //    BigIntBackend<T>::BigIntBackend(unsigned char *bytes, std::size_t count): isNegative(false) {
 //        std::bitset<PIECE_SIZE> buffer;
@@ -119,6 +141,13 @@ namespace BigNumbers {
 
     template<class T>
     void BigIntBackend<T>::add(const BigIntBackend<T> &addend) {
+        BIG_NUMBERS_COUNT(ADDITIONS, 1);
+        BIG_NUMBERS_COUNT(LIMBS_PROCESSED, pieces.size() + addend.pieces.size());
+
+#ifdef BIG_NUMBERS_STATS
+        std::size_t capacity = pieces.capacity();
+#endif
+
         auto firstIt = pieces.begin();
         auto secondIt = addend.pieces.begin();
 
@@ -152,6 +181,12 @@ namespace BigNumbers {
         if (additional != getFillValue()) {
             pieces.push_back(additional.to_ulong());
         }
+
+#ifdef BIG_NUMBERS_STATS
+        if (pieces.capacity() != capacity) {
+            BIG_NUMBERS_COUNT_ALLOCATION(pieces.capacity() * sizeof(T));
+        }
+#endif
     }
 
     template<class T>
@@ -179,25 +214,26 @@ namespace BigNumbers {
         SizeType pieceShift = shiftBy % BigIntBackend<T>::PIECE_SIZE;
         SizeType pieceShiftComplement = BigIntBackend<T>::PIECE_SIZE - pieceShift;
 
-        T previous = pieces.front();
-        if (!pieces.empty()) {
+        // Whole-piece shifts must not reach bit shifts by full piece width, which are undefined for 64-bit pieces.
+        if (pieceShift > 0 && !pieces.empty()) {
+            T previous = pieces.front();
             pieces.front() <<= pieceShift;
-        }
 
-        for (std::size_t i = 1; i < pieces.size(); ++i) {
-            T current = pieces[i];
-            pieces[i] <<= pieceShift;
-            pieces[i] |= (previous >> pieceShiftComplement);
-            previous = current;
-        }
+            for (std::size_t i = 1; i < pieces.size(); ++i) {
+                T current = pieces[i];
+                pieces[i] <<= pieceShift;
+                pieces[i] |= (previous >> pieceShiftComplement);
+                previous = current;
+            }
 
-        T fillValue = getFillValue();
+            T fillValue = getFillValue();
 
-        T additionalPiece = (previous >> pieceShiftComplement) |
-                            (fillValue << pieceShift);
+            T additionalPiece = (previous >> pieceShiftComplement) |
+                                (fillValue << pieceShift);
 
-        if (additionalPiece != fillValue) {
-            pieces.push_back(additionalPiece);
+            if (additionalPiece != fillValue) {
+                pieces.push_back(additionalPiece);
+            }
         }
 
         SizeType emptyPieceCount = shiftBy / BigIntBackend<T>::PIECE_SIZE;
@@ -207,7 +243,10 @@ namespace BigNumbers {
     }
 
     template<class T>
-    void BigIntBackend<T>::multiply(BigIntBackend<T> multiplicand) {
+    void BigIntBackend<T>::multiply(BigIntBackend<T> multiplicand, bool isParallel) {
+        BIG_NUMBERS_COUNT(MULTIPLICATIONS, 1);
+        BIG_NUMBERS_COUNT(LIMBS_PROCESSED, pieces.size() + multiplicand.pieces.size());
+
         bool isResultNegative = this->isNegative ^ multiplicand.isNegative;
 
         if (this->isNegative) {
@@ -218,45 +257,56 @@ namespace BigNumbers {
             multiplicand.negate();
         }
 
-        auto sortedValues = BigIntBackend<T>::sortBySize(*this, multiplicand);
+        normalize();
+        multiplicand.normalize();
 
-        BigIntBackend<T> &shortestMultiplicand = sortedValues.first;
-        BigIntBackend<T> &longestMultiplicand = sortedValues.second;
+        BigIntBackend<T> product(false, Magnitude::multiply(pieces, multiplicand.pieces, isParallel));
+        product.normalize();
 
-        BigIntBackend<T> product;
-        product.isNegative = isNegative ^ multiplicand.isNegative;
+        if (product.compare(BigIntBackend<T>(0)) == 0) {
+            product.isNegative = false;
+        } else if (isResultNegative) {
+            product.negate();
+        }
 
-        T mask = 0b1;
+        *this = product;
+    }
 
-        std::size_t i = 0;
-        SizeType prevShift = 0;
+    template<class T>
+    std::size_t BigIntBackend<T>::multiplyHigh(BigIntBackend<T> multiplicand, std::size_t width, bool isParallel) {
+        BIG_NUMBERS_COUNT(MULTIPLICATIONS, 1);
+        BIG_NUMBERS_COUNT(LIMBS_PROCESSED, std::min(pieces.size(), width) + std::min(multiplicand.pieces.size(), width));
 
-        BigIntBackend<T> &shiftMultiplicand = longestMultiplicand;
-        for (T currentPiece: shortestMultiplicand.pieces) {
-            for (SizeType j = 0; j < BigIntBackend<T>::PIECE_SIZE; ++j) {
-                T currentMask = mask << j;
+        bool isResultNegative = isNegative != multiplicand.isNegative;
 
-                if (currentPiece & currentMask) {
-                    SizeType currShift = j + i * BigIntBackend<T>::PIECE_SIZE;
-                    shiftMultiplicand.shiftLeft(currShift - prevShift);
-                    prevShift = currShift;
-                    product.add(shiftMultiplicand);
-                }
-            }
-            ++i;
+        if (isNegative) {
+            negate();
         }
 
-        if (product.compare(BigIntBackend<T>(0)) == 0) {
-            product.isNegative = false;
+        if (multiplicand.isNegative) {
+            multiplicand.negate();
+        }
+
+        normalize();
+        multiplicand.normalize();
+
+        std::size_t dropped;
+        pieces = Magnitude::multiplyHigh(pieces, multiplicand.pieces, width, dropped, isParallel);
+
+        if (pieces.empty()) {
+            dropped = 0;
         } else if (isResultNegative) {
-            product.negate();
+            negate();
         }
 
-        *this = product;
+        return dropped;
     }
 
     template<class T>
     BigIntBackend<T> BigIntBackend<T>::divide(BigIntBackend<T> divisor) {
+        BIG_NUMBERS_COUNT(DIVISIONS, 1);
+        BIG_NUMBERS_COUNT(LIMBS_PROCESSED, pieces.size() + divisor.pieces.size());
+
         if (divisor.compare(BigIntBackend<T>(0)) == 0) {
             throw std::logic_error("Cannot divide by zero.");
         }
@@ -271,29 +321,27 @@ namespace BigNumbers {
             divisor.negate();
         }
 
-        BigIntBackend<T> remainder;
-        remainder.pieces.insert(remainder.pieces.begin(), 0);
+        normalize();
+        divisor.normalize();
 
-        for (auto piece = pieces.rbegin(); piece != pieces.rend(); ++piece) {
-            std::bitset<BigIntBackend<T>::PIECE_SIZE> pieceBits(*piece);
-            std::bitset<BigIntBackend<T>::PIECE_SIZE> quotientBits(0b0);
+        if (divisor.pieces.size() == 1) {
+            BIG_NUMBERS_COUNT(PIECE_DIVISIONS, 1);
+            T remainderPiece = divideByPiece(divisor.pieces.front());
 
-            for (std::size_t j = BigIntBackend<T>::PIECE_SIZE; j > 0; --j) {
-                std::size_t bitIndex = j - 1;
-                remainder.shiftLeft(1);
+            normalize();
+            if (outputSign) {
+                negate();
+            }
 
-                std::bitset<BigIntBackend<T>::PIECE_SIZE> remainderBits(remainder.pieces.front());
-                remainderBits.set(0, pieceBits[bitIndex]);
-                remainder.pieces.front() = static_cast<T>(remainderBits.to_ulong());
+            BigIntBackend<T> remainder(false, {remainderPiece});
+            remainder.normalize();
 
-                if (remainder.compare(divisor) >= 0) {
-                    remainder.subtract(divisor);
-                    quotientBits.set(bitIndex, true);
-                }
-            }
-            *piece = static_cast<T>(quotientBits.to_ulong());
+            return remainder;
         }
 
+        BigIntBackend<T> remainder;
+        Magnitude::divide(pieces, divisor.pieces, remainder.pieces);
+
         normalize();
         if (outputSign) {
             negate();
@@ -303,8 +351,26 @@ namespace BigNumbers {
         return remainder;
     }
 
+    template<class T>
+    T BigIntBackend<T>::divideByPiece(T divisor) {
+        using Wide = typename DoublePiece<T>::type;
+
+        Wide remainder = 0;
+
+        for (auto piece = pieces.rbegin(); piece != pieces.rend(); ++piece) {
+            Wide current = (remainder << BigIntBackend<T>::PIECE_SIZE) | *piece;
+            *piece = static_cast<T>(current / divisor);
+            remainder = current % divisor;
+        }
+
+        return static_cast<T>(remainder);
+    }
+
     template<class T>
     int8_t BigIntBackend<T>::compare(BigIntBackend<T> secondOperand) const {
+        BIG_NUMBERS_COUNT(COMPARISONS, 1);
+        BIG_NUMBERS_COUNT(LIMBS_PROCESSED, pieces.size() + secondOperand.pieces.size());
+
         BigIntBackend<T> firstOperand = *this;
         secondOperand.normalize();
         firstOperand.normalize();
@@ -317,8 +383,9 @@ namespace BigNumbers {
             return 1;
         }
 
+        // Longer negative values have larger magnitude, so they are smaller.
         if (firstOperand.pieces.size() != secondOperand.pieces.size()) {
-            if (firstOperand.pieces.size() > secondOperand.pieces.size()) {
+            if ((firstOperand.pieces.size() > secondOperand.pieces.size()) != firstOperand.isNegative) {
                 return 1;
             }
 
@@ -343,33 +410,21 @@ namespace BigNumbers {
 
     template<class T>
     void BigIntBackend<T>::normalize() {
+        BIG_NUMBERS_COUNT(NORMALIZATIONS, 1);
+
         trimBack(pieces, getFillValue());
     }
 
     template<class T>
     std::string BigIntBackend<T>::toString() const {
-        BigIntBackend<T> zero(0);
-
-        if (compare(zero) == 0) {
-            return "0";
-        }
-
-        std::string valueAsString;
-
         auto value = *this;
         if (value.isNegative) {
             value.negate();
         }
 
-        BigIntBackend<T> ten(10);
+        std::string valueAsString = toDecimalString(value);
 
-        while (value.compare(zero) > 0) {
-            valueAsString += static_cast<char>(value.divide(ten)) + '0';
-        }
-
-        std::reverse(valueAsString.begin(), valueAsString.end());
-
-        if (isNegative) {
+        if (isNegative && valueAsString != "0") {
             valueAsString = "-" + valueAsString;
         }
 
@@ -382,7 +437,7 @@ namespace BigNumbers {
     }
 
     template<class T>
-    std::vector<T> BigIntBackend<T>::accessPieces() const {
+    const std::vector<T> &BigIntBackend<T>::accessPieces() const {
         return pieces;
     }
 
@@ -420,7 +475,9 @@ namespace BigNumbers {
     template
     class BigIntBackend<PieceType>;
 
-    // Additional tests
+    // Additional tests, 64-bit pieces need 128-bit products
+#ifdef __SIZEOF_INT128__
     template
     class BigIntBackend<uint64_t>;
+#endif
 }
\ No newline at end of file
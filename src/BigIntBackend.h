@@ -27,14 +27,29 @@ namespace BigNumbers {
 
         BigIntBackend(bool sign, std::vector<T> pieces);
 
+        // Copies are defined explicitly, so that their allocations are seen by statistics.
+        BigIntBackend(const BigIntBackend<T> &other);
+
+        BigIntBackend(BigIntBackend<T> &&other) = default;
+
+        BigIntBackend<T> &operator=(const BigIntBackend<T> &other);
+
+        BigIntBackend<T> &operator=(BigIntBackend<T> &&other) = default;
+
         // Perform addition operation on this object and argument. Result is written to this object.
         void add(const BigIntBackend<T> &addend);
 
         // Perform subtraction operation on this object and argument. Result is written to this object.
         void subtract(BigIntBackend<T> subtrahend);
 
-        // Perform multiplication operation on this object and argument. Result is written to this object.
-        void multiply(BigIntBackend<T> multiplicand);
+        // Perform multiplication operation on this object and argument. Result is written to this object. Products of
+        // huge operands are split between threads of the pool, unless isParallel is false.
+        void multiply(BigIntBackend<T> multiplicand, bool isParallel = true);
+
+        // Perform multiplication, which keeps only top pieces of product: at least width of them and a few guard pieces
+        // below, which may be slightly less than exact ones. Lower pieces of operands, which do not reach them, are
+        // ignored. Result is written to this object, returns amount of dropped lower pieces of product.
+        std::size_t multiplyHigh(BigIntBackend<T> multiplicand, std::size_t width, bool isParallel = true);
 
         // Perform division operation on this object and argument. Result is written to this object. Returns remainder.
         BigIntBackend<T> divide(BigIntBackend<T> divisor);
@@ -64,7 +79,7 @@ namespace BigNumbers {
 
         std::vector<T> &accessPieces();
 
-        std::vector<T> accessPieces() const;
+        const std::vector<T> &accessPieces() const;
 
         int32_t getSign() const;
 
@@ -73,6 +88,9 @@ namespace BigNumbers {
     private:
         static std::pair<BigIntBackend<T> &, BigIntBackend<T> &>
         sortBySize(BigIntBackend<T> &first, BigIntBackend<T> &second);
+
+        // Divide non-negative value by single piece in one pass. Result is written to this object. Returns remainder.
+        T divideByPiece(T divisor);
     };
 
     template<class T>
@@ -89,10 +107,12 @@ namespace BigNumbers {
         auto byteArray = getBytes();
 
         if (byteArray.second - 1 > sizeof(Value)) {
+            delete[] byteArray.first;
             throw std::logic_error("Cannot cast BigIntBackend to given type - value is too big.");
         }
 
         std::memcpy(reinterpret_cast<unsigned char *>(&value), byteArray.first, byteArray.second - 1);
+        delete[] byteArray.first;
 
         return value;
     }
@@ -0,0 +1,305 @@
+#include "BigIntBatch.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace BigNumbers {
+    namespace {
+        // Amount of limb operations, which is long enough to outweigh task scheduling.
+        constexpr std::size_t PARALLEL_GRAIN = 1 << 16;
+
+        // Runs kernel on ranges of elements, splitting long batches between threads of the pool.
+        template<class Kernel>
+        void forEachRange(std::size_t elementCount, std::size_t limbCount, const Kernel &kernel) {
+            std::size_t threadCount = getThreadCount();
+            std::size_t rangeSize = PARALLEL_GRAIN / (limbCount * limbCount) + 1;
+
+            if (threadCount < 2 || elementCount <= rangeSize) {
+                kernel(0, elementCount);
+                return;
+            }
+
+            if (elementCount / rangeSize > threadCount * 4) {
+                rangeSize = elementCount / (threadCount * 4) + 1;
+            }
+
+            ThreadPool::TaskGroup tasks;
+            for (std::size_t begin = 0; begin < elementCount; begin += rangeSize) {
+                std::size_t end = std::min(elementCount, begin + rangeSize);
+
+                tasks.run([&kernel, begin, end]() {
+                    kernel(begin, end);
+                });
+            }
+
+            tasks.wait();
+        }
+    }
+
+    BigIntBatch::BigIntBatch(std::size_t size, std::size_t bitWidth)
+            : elementCount(size), limbCount((bitWidth + LIMB_SIZE - 1) / LIMB_SIZE) {
+        if (limbCount == 0) {
+            throw std::logic_error("Bit width of batch must be positive.");
+        }
+
+        limbs.assign(limbCount * elementCount, 0);
+    }
+
+    BigIntBatch::BigIntBatch(const std::vector<BigInt> &values, std::size_t bitWidth)
+            : BigIntBatch(values.size(), bitWidth) {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            set(i, values[i]);
+        }
+    }
+
+    std::size_t BigIntBatch::size() const {
+        return elementCount;
+    }
+
+    std::size_t BigIntBatch::getBitWidth() const {
+        return limbCount * LIMB_SIZE;
+    }
+
+    BigInt BigIntBatch::get(std::size_t index) const {
+        if (index >= elementCount) {
+            throw std::logic_error("Batch index is out of range.");
+        }
+
+        std::vector<unsigned char> bytes;
+        for (std::size_t i = 0; i < limbCount; ++i) {
+            Limb limb = limbs[i * elementCount + index];
+
+            for (std::size_t j = 0; j < sizeof(Limb); ++j) {
+                bytes.push_back(static_cast<unsigned char>(limb >> (j * 8)));
+            }
+        }
+        bytes.push_back(bytes.back() >> 7 ? 0xFF : 0);
+
+        return BigInt(bytes.data(), bytes.size());
+    }
+
+    void BigIntBatch::set(std::size_t index, const BigInt &value) {
+        if (index >= elementCount) {
+            throw std::logic_error("Batch index is out of range.");
+        }
+
+        std::vector<Limb> valueLimbs = toLimbs(value);
+        for (std::size_t i = 0; i < limbCount; ++i) {
+            limbs[i * elementCount + index] = valueLimbs[i];
+        }
+    }
+
+    BigIntBatch &BigIntBatch::operator+=(const BigIntBatch &addend) {
+        checkShape(addend);
+        add(addend.limbs.data(), elementCount, 1);
+
+        return *this;
+    }
+
+    BigIntBatch BigIntBatch::operator+(const BigIntBatch &addend) const {
+        BigIntBatch result = *this;
+        return result += addend;
+    }
+
+    BigIntBatch &BigIntBatch::operator-=(const BigIntBatch &subtrahend) {
+        checkShape(subtrahend);
+        subtract(subtrahend.limbs.data(), elementCount, 1);
+
+        return *this;
+    }
+
+    BigIntBatch BigIntBatch::operator-(const BigIntBatch &subtrahend) const {
+        BigIntBatch result = *this;
+        return result -= subtrahend;
+    }
+
+    BigIntBatch &BigIntBatch::operator*=(const BigIntBatch &multiplicand) {
+        checkShape(multiplicand);
+        multiply(multiplicand.limbs.data(), elementCount, 1);
+
+        return *this;
+    }
+
+    BigIntBatch BigIntBatch::operator*(const BigIntBatch &multiplicand) const {
+        BigIntBatch result = *this;
+        return result *= multiplicand;
+    }
+
+    BigIntBatch &BigIntBatch::operator+=(const BigInt &addend) {
+        std::vector<Limb> addendLimbs = toLimbs(addend);
+        add(addendLimbs.data(), 1, 0);
+
+        return *this;
+    }
+
+    BigIntBatch &BigIntBatch::operator-=(const BigInt &subtrahend) {
+        std::vector<Limb> subtrahendLimbs = toLimbs(subtrahend);
+        subtract(subtrahendLimbs.data(), 1, 0);
+
+        return *this;
+    }
+
+    BigIntBatch &BigIntBatch::operator*=(const BigInt &multiplicand) {
+        std::vector<Limb> multiplicandLimbs = toLimbs(multiplicand);
+        multiply(multiplicandLimbs.data(), 1, 0);
+
+        return *this;
+    }
+
+    std::vector<int8_t> BigIntBatch::compare(const BigIntBatch &other) const {
+        checkShape(other);
+        return compare(other.limbs.data(), elementCount, 1);
+    }
+
+    std::vector<int8_t> BigIntBatch::compare(const BigInt &value) const {
+        std::vector<Limb> valueLimbs = toLimbs(value);
+        return compare(valueLimbs.data(), 1, 0);
+    }
+
+    std::vector<BigIntBatch::Limb> BigIntBatch::toLimbs(const BigInt &value) const {
+        auto bytes = value.getBytes();
+
+        // Last byte only holds the sign, so it is used as filler of the remaining limbs.
+        unsigned char fill = bytes.first[bytes.second - 1];
+        std::size_t byteCount = bytes.second - 1;
+        bool isFitting = byteCount <= limbCount * sizeof(Limb) &&
+                         (byteCount < limbCount * sizeof(Limb) || (bytes.first[byteCount - 1] ^ fill) >> 7 == 0);
+
+        std::vector<Limb> result(limbCount, 0);
+        if (isFitting) {
+            for (std::size_t i = 0; i < limbCount * sizeof(Limb); ++i) {
+                Limb byte = i < byteCount ? bytes.first[i] : fill;
+                result[i / sizeof(Limb)] |= byte << (i % sizeof(Limb) * 8);
+            }
+        }
+        delete[] bytes.first;
+
+        if (!isFitting) {
+            throw std::logic_error("Value does not fit into bit width of batch.");
+        }
+
+        return result;
+    }
+
+    void BigIntBatch::checkShape(const BigIntBatch &other) const {
+        if (elementCount != other.elementCount || limbCount != other.limbCount) {
+            throw std::logic_error("Batches must have the same size and bit width.");
+        }
+    }
+
+    void BigIntBatch::add(const Limb *other, std::size_t limbStride, std::size_t elementStride) {
+        Limb *values = limbs.data();
+        std::size_t count = elementCount;
+        std::size_t width = limbCount;
+
+        forEachRange(count, width, [=](std::size_t begin, std::size_t end) {
+            std::vector<Limb> carries(end - begin, 0);
+
+            for (std::size_t i = 0; i < width; ++i) {
+                Limb *row = values + i * count;
+                const Limb *otherRow = other + i * limbStride;
+
+                for (std::size_t j = begin; j < end; ++j) {
+                    uint64_t sum = static_cast<uint64_t>(row[j]) + otherRow[j * elementStride] + carries[j - begin];
+                    row[j] = static_cast<Limb>(sum);
+                    carries[j - begin] = static_cast<Limb>(sum >> LIMB_SIZE);
+                }
+            }
+        });
+    }
+
+    void BigIntBatch::subtract(const Limb *other, std::size_t limbStride, std::size_t elementStride) {
+        Limb *values = limbs.data();
+        std::size_t count = elementCount;
+        std::size_t width = limbCount;
+
+        forEachRange(count, width, [=](std::size_t begin, std::size_t end) {
+            std::vector<Limb> borrows(end - begin, 0);
+
+            for (std::size_t i = 0; i < width; ++i) {
+                Limb *row = values + i * count;
+                const Limb *otherRow = other + i * limbStride;
+
+                for (std::size_t j = begin; j < end; ++j) {
+                    uint64_t difference =
+                            static_cast<uint64_t>(row[j]) - otherRow[j * elementStride] - borrows[j - begin];
+                    row[j] = static_cast<Limb>(difference);
+                    borrows[j - begin] = static_cast<Limb>(difference >> LIMB_SIZE) & 1;
+                }
+            }
+        });
+    }
+
+    // Schoolbook product, which keeps only the lower limbs. Lower bits of two's complement product do not depend on
+    // signs of operands.
+    void BigIntBatch::multiply(const Limb *other, std::size_t limbStride, std::size_t elementStride) {
+        Limb *values = limbs.data();
+        std::size_t count = elementCount;
+        std::size_t width = limbCount;
+
+        forEachRange(count, width, [=](std::size_t begin, std::size_t end) {
+            std::size_t rangeSize = end - begin;
+            std::vector<Limb> product(width * rangeSize, 0);
+            std::vector<Limb> carries(rangeSize);
+
+            for (std::size_t i = 0; i < width; ++i) {
+                const Limb *row = values + i * count + begin;
+                std::fill(carries.begin(), carries.end(), 0);
+
+                for (std::size_t k = 0; i + k < width; ++k) {
+                    const Limb *otherRow = other + k * limbStride + begin * elementStride;
+                    Limb *productRow = product.data() + (i + k) * rangeSize;
+
+                    for (std::size_t j = 0; j < rangeSize; ++j) {
+                        uint64_t sum = static_cast<uint64_t>(row[j]) * otherRow[j * elementStride] + productRow[j] +
+                                       carries[j];
+                        productRow[j] = static_cast<Limb>(sum);
+                        carries[j] = static_cast<Limb>(sum >> LIMB_SIZE);
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < width; ++i) {
+                std::copy(product.begin() + i * rangeSize, product.begin() + (i + 1) * rangeSize,
+                          values + i * count + begin);
+            }
+        });
+    }
+
+    std::vector<int8_t> BigIntBatch::compare(const Limb *other, std::size_t limbStride,
+                                             std::size_t elementStride) const {
+        std::vector<int8_t> result(elementCount, 0);
+
+        const Limb *values = limbs.data();
+        int8_t *results = result.data();
+        std::size_t count = elementCount;
+        std::size_t width = limbCount;
+
+        forEachRange(count, width, [=](std::size_t begin, std::size_t end) {
+            // Highest limbs hold signs, so they are compared as signed values.
+            const Limb *row = values + (width - 1) * count;
+            const Limb *otherRow = other + (width - 1) * limbStride;
+
+            for (std::size_t j = begin; j < end; ++j) {
+                auto value = static_cast<int32_t>(row[j]);
+                auto otherValue = static_cast<int32_t>(otherRow[j * elementStride]);
+                results[j] = static_cast<int8_t>((value > otherValue) - (value < otherValue));
+            }
+
+            for (std::size_t i = width - 1; i-- > 0;) {
+                row = values + i * count;
+                otherRow = other + i * limbStride;
+
+                for (std::size_t j = begin; j < end; ++j) {
+                    Limb value = row[j];
+                    Limb otherValue = otherRow[j * elementStride];
+                    auto limbResult = static_cast<int8_t>((value > otherValue) - (value < otherValue));
+                    results[j] = results[j] != 0 ? results[j] : limbResult;
+                }
+            }
+        });
+
+        return result;
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef BIG_NUMBERS_BIGINTBATCH_H
+#define BIG_NUMBERS_BIGINTBATCH_H
+
+#include "BigInt.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BigNumbers {
+    // Column of signed integers of the same width. Values are stored as structure of arrays: i-th limbs of all
+    // elements are contiguous, so element-wise operations are loops over elements, which compilers vectorize, and
+    // long columns are split between threads of the pool. Values are two's complement numbers of bit width rounded
+    // up to 32 bits; arithmetic wraps around on overflow, like fixed-width machine integers.
+    class BigIntBatch {
+    public:
+        BigIntBatch(std::size_t size, std::size_t bitWidth);
+
+        BigIntBatch(const std::vector<BigInt> &values, std::size_t bitWidth);
+
+        std::size_t size() const;
+
+        std::size_t getBitWidth() const;
+
+        BigInt get(std::size_t index) const;
+
+        // Throws std::logic_error if value does not fit into bit width of the batch.
+        void set(std::size_t index, const BigInt &value);
+
+        BigIntBatch &operator+=(const BigIntBatch &addend);
+
+        BigIntBatch operator+(const BigIntBatch &addend) const;
+
+        BigIntBatch &operator-=(const BigIntBatch &subtrahend);
+
+        BigIntBatch operator-(const BigIntBatch &subtrahend) const;
+
+        BigIntBatch &operator*=(const BigIntBatch &multiplicand);
+
+        BigIntBatch operator*(const BigIntBatch &multiplicand) const;
+
+        // Scalar operations apply the same value to each element.
+        BigIntBatch &operator+=(const BigInt &addend);
+
+        BigIntBatch &operator-=(const BigInt &subtrahend);
+
+        BigIntBatch &operator*=(const BigInt &multiplicand);
+
+        // Element-wise comparison: -1, 0 or 1 for each element.
+        std::vector<int8_t> compare(const BigIntBatch &other) const;
+
+        std::vector<int8_t> compare(const BigInt &value) const;
+
+    private:
+        using Limb = uint32_t;
+
+        static constexpr std::size_t LIMB_SIZE = sizeof(Limb) * 8;
+
+        std::size_t elementCount;
+        std::size_t limbCount;
+
+        // Limb i of element j is stored at index i * elementCount + j.
+        std::vector<Limb> limbs;
+
+        // Limbs of given value, which are repeated for each element of scalar operations.
+        std::vector<Limb> toLimbs(const BigInt &value) const;
+
+        void checkShape(const BigIntBatch &other) const;
+
+        // Limbs of other operand are read at index i * limbStride + j * elementStride, so scalars have zero
+        // element stride.
+        void add(const Limb *other, std::size_t limbStride, std::size_t elementStride);
+
+        void subtract(const Limb *other, std::size_t limbStride, std::size_t elementStride);
+
+        void multiply(const Limb *other, std::size_t limbStride, std::size_t elementStride);
+
+        std::vector<int8_t> compare(const Limb *other, std::size_t limbStride, std::size_t elementStride) const;
+    };
+}
+
+#endif //BIG_NUMBERS_BIGINTBATCH_H
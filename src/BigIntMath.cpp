@@ -0,0 +1,110 @@
+#include "BigIntMath.h"
+
+#include "BigIntBackend.h"
+#include "IsomorphicMath.h"
+#include "NumberTheoryUtils.h"
+#include "config.h"
+
+namespace BigNumbers {
+    BigIntBackend<PieceType> toBackend(const BigInt &value) {
+        auto bytes = value.getBytes();
+        BigIntBackend<PieceType> backend(bytes.first, bytes.second);
+        delete[] bytes.first;
+
+        return backend;
+    }
+
+    BigInt fromBackend(const BigIntBackend<PieceType> &backend) {
+        auto bytes = backend.getBytes();
+        BigInt value(bytes.first, bytes.second);
+        delete[] bytes.first;
+
+        return value;
+    }
+
+    BigInt gcd(const BigInt &first, const BigInt &second) {
+        return fromBackend(gcd(toBackend(first), toBackend(second)));
+    }
+
+    BigInt lcm(const BigInt &first, const BigInt &second) {
+        return fromBackend(lcm(toBackend(first), toBackend(second)));
+    }
+
+    BigInt gcdext(const BigInt &first, const BigInt &second, BigInt &firstCoefficient, BigInt &secondCoefficient) {
+        BigIntBackend<PieceType> firstBackend, secondBackend;
+        BigIntBackend<PieceType> result = gcdext(toBackend(first), toBackend(second), firstBackend, secondBackend);
+
+        firstCoefficient = fromBackend(firstBackend);
+        secondCoefficient = fromBackend(secondBackend);
+
+        return fromBackend(result);
+    }
+
+    BigInt modInverse(const BigInt &value, const BigInt &modulus) {
+        return fromBackend(modInverse(toBackend(value), toBackend(modulus)));
+    }
+
+    BigInt chineseRemainder(const std::vector<BigInt> &residues, const std::vector<BigInt> &moduli) {
+        std::vector<BigIntBackend<PieceType>> residueBackends, modulusBackends;
+
+        for (const auto &residue: residues) {
+            residueBackends.push_back(toBackend(residue));
+        }
+
+        for (const auto &modulus: moduli) {
+            modulusBackends.push_back(toBackend(modulus));
+        }
+
+        return fromBackend(chineseRemainder(residueBackends, modulusBackends));
+    }
+
+    BigInt sqrtrem(const BigInt &value, BigInt &remainder) {
+        return rootrem(value, 2, remainder);
+    }
+
+    BigInt isqrt(const BigInt &value) {
+        return fromBackend(isqrt(toBackend(value)));
+    }
+
+    BigInt rootrem(const BigInt &value, std::size_t degree, BigInt &remainder) {
+        BigIntBackend<PieceType> remainderBackend;
+        BigIntBackend<PieceType> result = rootrem(toBackend(value), degree, remainderBackend);
+
+        remainder = fromBackend(remainderBackend);
+
+        return fromBackend(result);
+    }
+
+    BigInt iroot(const BigInt &value, std::size_t degree) {
+        return fromBackend(iroot(toBackend(value), degree));
+    }
+
+    BigInt pow(const BigInt &value, int power) {
+        if (power < 0) {
+            throw std::logic_error("Cannot raise integer to a negative power.");
+        }
+
+        return IsomorphicMath::pow(value, power);
+    }
+
+    BigInt pow(const BigInt &value, const BigInt &power) {
+        if (power < BigInt(0)) {
+            throw std::logic_error("Cannot raise integer to a negative power.");
+        }
+
+        return IsomorphicMath::pow(value, power);
+    }
+
+    BigInt fibonacci(uint64_t n) {
+        return fromBackend(fibonacci<PieceType>(n));
+    }
+
+    BigInt lucas(uint64_t n) {
+        return fromBackend(lucas<PieceType>(n));
+    }
+
+    BigInt linearRecurrence(const std::vector<BigInt> &coefficients, const std::vector<BigInt> &initialValues,
+                            uint64_t n) {
+        return IsomorphicMath::linearRecurrence(coefficients, initialValues, n);
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef BIG_NUMBERS_BIGINTMATH_H
+#define BIG_NUMBERS_BIGINTMATH_H
+
+#include "BigInt.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BigNumbers {
+    // Greatest common divisor of absolute values of both arguments.
+    BigInt gcd(const BigInt &first, const BigInt &second);
+
+    // Least common multiple of absolute values of both arguments.
+    BigInt lcm(const BigInt &first, const BigInt &second);
+
+    // Greatest common divisor, which also writes Bezout coefficients:
+    // first * firstCoefficient + second * secondCoefficient = gcd(first, second).
+    BigInt gcdext(const BigInt &first, const BigInt &second, BigInt &firstCoefficient, BigInt &secondCoefficient);
+
+    // Inverse of value modulo positive modulus, which lies in range [0, modulus).
+    BigInt modInverse(const BigInt &value, const BigInt &modulus);
+
+    // Smallest non-negative value, which is congruent to each residue modulo corresponding modulus. Moduli must be
+    // positive and pairwise coprime.
+    BigInt chineseRemainder(const std::vector<BigInt> &residues, const std::vector<BigInt> &moduli);
+
+    // Floor of square root of non-negative value. Remainder value - root^2 is written to the last argument.
+    BigInt sqrtrem(const BigInt &value, BigInt &remainder);
+
+    BigInt isqrt(const BigInt &value);
+
+    // Root of given degree, rounded towards zero. Remainder value - root^degree is written to the last argument.
+    BigInt rootrem(const BigInt &value, std::size_t degree, BigInt &remainder);
+
+    BigInt iroot(const BigInt &value, std::size_t degree);
+
+    // Raises value to non-negative power by sliding window exponentiation.
+    BigInt pow(const BigInt &value, int power);
+
+    BigInt pow(const BigInt &value, const BigInt &power);
+
+    // n-th Fibonacci number, computed by fast doubling with O(log n) squarings.
+    BigInt fibonacci(uint64_t n);
+
+    // n-th Lucas number: L(0) = 2, L(1) = 1, L(n) = L(n - 1) + L(n - 2).
+    BigInt lucas(uint64_t n);
+
+    // n-th term of recurrence a(i) = coefficients[0] * a(i - 1) + ... + coefficients[k - 1] * a(i - k), which starts
+    // with k initial values a(0), ..., a(k - 1). Takes O(k^2 log n) multiplications.
+    BigInt linearRecurrence(const std::vector<BigInt> &coefficients, const std::vector<BigInt> &initialValues,
+                            uint64_t n);
+}
+
+#endif //BIG_NUMBERS_BIGINTMATH_H
@@ -0,0 +1,556 @@
+#include "BigInterval.h"
+
+#include "BigFloatImplementation.h"
+
+#include <map>
+
+namespace BigNumbers {
+    class BigInterval::Implementation {
+    public:
+        static constexpr std::size_t PIECE_BITS = 8 * sizeof(PieceType);
+
+        // Bits, which elementary functions compute beyond precision of their result, so that rounding errors of
+        // their series do not widen it.
+        static constexpr std::size_t GUARD_BITS = 32;
+
+        // Bits are counted after the leading bit of each bound, when precision was set in bits.
+        std::size_t bitPrecision;
+        bool isSignificant;
+        BigFloatBackend<PieceType> lower;
+        BigFloatBackend<PieceType> upper;
+
+        Implementation(const BigFloatBackend<PieceType> &lower, const BigFloatBackend<PieceType> &upper) :
+                bitPrecision(BigFloat::getDefaultPrecision() * PIECE_BITS), isSignificant(false), lower(lower),
+                upper(upper) {
+
+        }
+
+        BigFloatBackend<PieceType>::Rounding getRounding(RoundingMode mode) const {
+            if (isSignificant) {
+                return {bitPrecision + PIECE_BITS - 1, mode, bitPrecision};
+            }
+
+            return {bitPrecision, mode};
+        }
+
+        // Rounds bounds outwards to given precision, which results of operations take.
+        void setBitPrecision(std::size_t newBitPrecision, bool isNewSignificant) {
+            bitPrecision = newBitPrecision;
+            isSignificant = isNewSignificant;
+
+            lower.round(getRounding(RoundingMode::DOWN));
+            upper.round(getRounding(RoundingMode::UP));
+        }
+
+        // Interval, which holds single value and rounds results of operations on it to given bit precision.
+        static BigInterval point(const BigFloatBackend<PieceType> &value, std::size_t bitPrecision) {
+            BigInterval interval(new Implementation(value, value));
+            interval.implementation->bitPrecision = bitPrecision;
+
+            return interval;
+        }
+
+        static bool isZero(const BigFloatBackend<PieceType> &value) {
+            return value.compare(BigFloatBackend<PieceType>()) == 0;
+        }
+
+        static bool isNegative(const BigFloatBackend<PieceType> &value) {
+            return value.compare(BigFloatBackend<PieceType>()) < 0;
+        }
+
+        static BigFloatBackend<PieceType> power2(int64_t exponent) {
+            BigFloatBackend<PieceType> value(BigIntBackend<PieceType>(1));
+            value.scaleBits(exponent);
+
+            return value;
+        }
+
+        // Greatest absolute value of interval.
+        static BigFloatBackend<PieceType> getMagnitude(const BigInterval &value) {
+            BigFloatBackend<PieceType> lower = value.implementation->lower, upper = value.implementation->upper;
+
+            if (isNegative(lower)) {
+                lower.negate();
+            }
+
+            if (isNegative(upper)) {
+                upper.negate();
+            }
+
+            return lower.compare(upper) > 0 ? lower : upper;
+        }
+
+        // Whether all values of interval lie below 2^exponent by absolute value.
+        static bool isBelow(const BigInterval &value, int64_t exponent) {
+            BigFloatBackend<PieceType> magnitude = getMagnitude(value);
+
+            return isZero(magnitude) || magnitude.getBitExponent() < exponent;
+        }
+
+        // Lowest bit, which series have to compute for a result of given magnitude. Results below one are kept to
+        // given amount of bits after their leading bit, the other ones to given amount of bits after the point.
+        static int64_t getSeriesLimit(const BigInterval &magnitude, std::size_t bitPrecision) {
+            BigFloatBackend<PieceType> leading = getMagnitude(magnitude);
+            int64_t exponent = isZero(leading) ? 0 : std::min<int64_t>(leading.getBitExponent(), 0);
+
+            return exponent - static_cast<int64_t>(bitPrecision);
+        }
+
+        // Widens interval by given magnitude in both directions.
+        static void widen(BigInterval &value, const BigFloatBackend<PieceType> &magnitude) {
+            Implementation &bounds = *value.implementation;
+
+            bounds.lower.subtract(magnitude, bounds.getRounding(RoundingMode::DOWN));
+            bounds.upper.add(magnitude, bounds.getRounding(RoundingMode::UP));
+        }
+
+        // Arctangent of value in (-1, 1) by its Taylor series, which alternates, so that the first omitted term bounds
+        // its remainder.
+        static BigInterval atan(const BigInterval &value, std::size_t bitPrecision) {
+            int64_t limit = getSeriesLimit(value, bitPrecision);
+
+            BigInterval sum = point(BigFloatBackend<PieceType>(), bitPrecision);
+            BigInterval power = value, square = value * value;
+            BigInterval term = power;
+
+            for (std::size_t i = 1; !isBelow(term, limit); i += 2) {
+                sum += i % 4 == 1 ? term : -term;
+                power *= square;
+                term = power / BigInterval(i + 2);
+            }
+
+            widen(sum, getMagnitude(term));
+
+            return sum;
+        }
+
+        // Inverse hyperbolic tangent of value in [-1/3, 1/3] by its Taylor series. Its remainder is below the first
+        // omitted term times 1 / (1 - value^2), which is less than two.
+        static BigInterval atanh(const BigInterval &value, std::size_t bitPrecision) {
+            int64_t limit = getSeriesLimit(value, bitPrecision);
+
+            BigInterval sum = point(BigFloatBackend<PieceType>(), bitPrecision);
+            BigInterval power = value, square = value * value;
+            BigInterval term = power;
+
+            for (std::size_t i = 1; !isBelow(term, limit); i += 2) {
+                sum += term;
+                power *= square;
+                term = power / BigInterval(i + 2);
+            }
+
+            BigFloatBackend<PieceType> remainder = getMagnitude(term);
+            remainder.scaleBits(1);
+            widen(sum, remainder);
+
+            return sum;
+        }
+
+        // Pi by Machin's formula pi = 16 atan(1/5) - 4 atan(1/239), cached for each thread and precision.
+        static BigInterval pi(std::size_t bitPrecision) {
+            static thread_local std::map<std::size_t, BigInterval> cache;
+
+            auto cached = cache.find(bitPrecision);
+            if (cached == cache.end()) {
+                BigInterval one = point(BigFloatBackend<PieceType>(BigIntBackend<PieceType>(1)), bitPrecision);
+                BigInterval value = atan(one / BigInterval(5), bitPrecision) * BigInterval(16) -
+                                    atan(one / BigInterval(239), bitPrecision) * BigInterval(4);
+
+                cached = cache.emplace(bitPrecision, value).first;
+            }
+
+            return cached->second;
+        }
+
+        // Logarithm of two as 2 atanh(1/3), cached for each thread and precision.
+        static BigInterval ln2(std::size_t bitPrecision) {
+            static thread_local std::map<std::size_t, BigInterval> cache;
+
+            auto cached = cache.find(bitPrecision);
+            if (cached == cache.end()) {
+                BigInterval one = point(BigFloatBackend<PieceType>(BigIntBackend<PieceType>(1)), bitPrecision);
+                cached = cache.emplace(bitPrecision, atanh(one / BigInterval(3), bitPrecision) * BigInterval(2)).first;
+            }
+
+            return cached->second;
+        }
+
+        static BigInterval sin(const BigFloatBackend<PieceType> &value, std::size_t bitPrecision) {
+            BigInterval reduced = point(value, bitPrecision);
+
+            if (!isZero(value) && value.getBitExponent() >= 2) {
+                // Any whole amount of turns may be subtracted, so the amount is found from approximate quotient. Pi
+                // is precise enough, that error of all turns stays below precision.
+                auto turnBits = static_cast<std::size_t>(value.getBitExponent());
+                BigInterval turn = pi(bitPrecision + turnBits) * BigInterval(2);
+
+                BigFloatBackend<PieceType> quotient = value;
+                quotient.divide(turn.implementation->lower, {PIECE_BITS, RoundingMode::NEAREST_EVEN});
+                quotient.add(power2(-1));
+
+                reduced -= turn * point(BigFloatBackend<PieceType>(static_cast<BigIntBackend<PieceType>>(quotient)),
+                                        bitPrecision);
+            }
+
+            // Taylor series, the first omitted term of which bounds its remainder.
+            int64_t limit = getSeriesLimit(reduced, bitPrecision);
+
+            BigInterval sum = point(BigFloatBackend<PieceType>(), bitPrecision);
+            BigInterval term = reduced, square = reduced * reduced;
+
+            for (std::size_t i = 1; !isBelow(term, limit); i += 2) {
+                sum += term;
+                term *= square;
+                term /= BigInterval((i + 1) * (i + 2));
+                term = -term;
+            }
+
+            widen(sum, getMagnitude(term));
+
+            return sum;
+        }
+
+        // Logarithm of positive value, which is split into 2^exponent and a factor in [3/4, 3/2), logarithm of which
+        // is 2 atanh(z) for z = (factor - 1) / (factor + 1) in [-1/7, 1/5].
+        static BigInterval ln(const BigFloatBackend<PieceType> &value, std::size_t bitPrecision) {
+            BigFloatBackend<PieceType> factor = value;
+            int64_t exponent = value.getBitExponent() + 1;
+            factor.scaleBits(-exponent);
+
+            BigFloatBackend<PieceType> threeQuarters(BigIntBackend<PieceType>(3));
+            threeQuarters.scaleBits(-2);
+
+            if (factor.compare(threeQuarters) < 0) {
+                factor.scaleBits(1);
+                --exponent;
+            }
+
+            BigInterval factorInterval = point(factor, bitPrecision);
+            BigInterval result = atanh((factorInterval - BigInterval(1)) / (factorInterval + BigInterval(1)),
+                                       bitPrecision) * BigInterval(2);
+
+            if (exponent != 0) {
+                // Error of ln(2) is multiplied by exponent, so it is computed with as many more bits.
+                std::size_t exponentBits = 0;
+                for (uint64_t rest = exponent > 0 ? exponent : -exponent; rest > 0; rest >>= 1) {
+                    ++exponentBits;
+                }
+
+                BigIntBackend<PieceType> exponentValue(exponent);
+                result += ln2(bitPrecision + exponentBits) *
+                          point(BigFloatBackend<PieceType>(exponentValue), bitPrecision);
+            }
+
+            return result;
+        }
+    };
+
+    BigInterval::BigInterval(Implementation *implementation) : implementation(implementation) {
+
+    }
+
+    BigInterval::BigInterval() : implementation(new Implementation(BigFloatBackend<PieceType>(),
+                                                                   BigFloatBackend<PieceType>())) {
+
+    }
+
+    BigInterval::BigInterval(const BigInterval &other) : implementation(new Implementation(*other.implementation)) {
+
+    }
+
+    BigInterval::BigInterval(const BigFloat &value) :
+            implementation(new Implementation(value.implementation->backend, value.implementation->backend)) {
+
+    }
+
+    BigInterval::BigInterval(const BigFloat &lower, const BigFloat &upper) :
+            implementation(new Implementation(lower.implementation->backend, upper.implementation->backend)) {
+        if (lower > upper) {
+            delete implementation;
+            throw std::logic_error("Lower bound of interval exceeds its upper bound.");
+        }
+    }
+
+    BigInterval::~BigInterval() {
+        delete implementation;
+    }
+
+    BigInterval &BigInterval::operator=(const BigInterval &other) {
+        if (&other != this) {
+            delete implementation;
+            implementation = new Implementation(*other.implementation);
+        }
+
+        return *this;
+    }
+
+    BigInterval &BigInterval::operator+=(const BigInterval &addend) {
+        implementation->lower.add(addend.implementation->lower, implementation->getRounding(RoundingMode::DOWN));
+        implementation->upper.add(addend.implementation->upper, implementation->getRounding(RoundingMode::UP));
+
+        return *this;
+    }
+
+    BigInterval BigInterval::operator+(const BigInterval &addend) const {
+        BigInterval copy = *this;
+        copy += addend;
+        return copy;
+    }
+
+    BigInterval &BigInterval::operator-=(const BigInterval &subtrahend) {
+        // Subtrahend may be this interval, so its lower bound is kept before it is changed.
+        BigFloatBackend<PieceType> subtrahendLower = subtrahend.implementation->lower;
+
+        implementation->lower.subtract(subtrahend.implementation->upper,
+                                       implementation->getRounding(RoundingMode::DOWN));
+        implementation->upper.subtract(subtrahendLower, implementation->getRounding(RoundingMode::UP));
+
+        return *this;
+    }
+
+    BigInterval BigInterval::operator-(const BigInterval &subtrahend) const {
+        BigInterval copy = *this;
+        copy -= subtrahend;
+        return copy;
+    }
+
+    BigInterval &BigInterval::operator*=(const BigInterval &multiplicand) {
+        // Bounds of product are the least and the greatest of products of bounds.
+        const BigFloatBackend<PieceType> *bounds[] = {&implementation->lower, &implementation->upper};
+        const BigFloatBackend<PieceType> *multiplicandBounds[] = {&multiplicand.implementation->lower,
+                                                                  &multiplicand.implementation->upper};
+
+        BigFloatBackend<PieceType> lower = *bounds[0], upper = *bounds[0];
+        lower.multiply(*multiplicandBounds[0], implementation->getRounding(RoundingMode::DOWN));
+        upper.multiply(*multiplicandBounds[0], implementation->getRounding(RoundingMode::UP));
+
+        for (int i = 1; i < 4; ++i) {
+            BigFloatBackend<PieceType> down = *bounds[i / 2], up = *bounds[i / 2];
+            down.multiply(*multiplicandBounds[i % 2], implementation->getRounding(RoundingMode::DOWN));
+            up.multiply(*multiplicandBounds[i % 2], implementation->getRounding(RoundingMode::UP));
+
+            if (down.compare(lower) < 0) {
+                lower = down;
+            }
+
+            if (up.compare(upper) > 0) {
+                upper = up;
+            }
+        }
+
+        implementation->lower = lower;
+        implementation->upper = upper;
+
+        return *this;
+    }
+
+    BigInterval BigInterval::operator*(const BigInterval &multiplicand) const {
+        BigInterval copy = *this;
+        copy *= multiplicand;
+        return copy;
+    }
+
+    BigInterval &BigInterval::operator/=(const BigInterval &divisor) {
+        BigFloatBackend<PieceType> zero;
+
+        if (divisor.implementation->lower.compare(zero) <= 0 && divisor.implementation->upper.compare(zero) >= 0) {
+            throw std::logic_error("Cannot divide by interval, which contains zero.");
+        }
+
+        // Bounds of quotient are the least and the greatest of quotients of bounds.
+        const BigFloatBackend<PieceType> *bounds[] = {&implementation->lower, &implementation->upper};
+        const BigFloatBackend<PieceType> *divisorBounds[] = {&divisor.implementation->lower,
+                                                             &divisor.implementation->upper};
+
+        BigFloatBackend<PieceType> lower = *bounds[0], upper = *bounds[0];
+        lower.divide(*divisorBounds[0], implementation->getRounding(RoundingMode::DOWN));
+        upper.divide(*divisorBounds[0], implementation->getRounding(RoundingMode::UP));
+
+        for (int i = 1; i < 4; ++i) {
+            BigFloatBackend<PieceType> down = *bounds[i / 2], up = *bounds[i / 2];
+            down.divide(*divisorBounds[i % 2], implementation->getRounding(RoundingMode::DOWN));
+            up.divide(*divisorBounds[i % 2], implementation->getRounding(RoundingMode::UP));
+
+            if (down.compare(lower) < 0) {
+                lower = down;
+            }
+
+            if (up.compare(upper) > 0) {
+                upper = up;
+            }
+        }
+
+        implementation->lower = lower;
+        implementation->upper = upper;
+
+        return *this;
+    }
+
+    BigInterval BigInterval::operator/(const BigInterval &divisor) const {
+        BigInterval copy = *this;
+        copy /= divisor;
+        return copy;
+    }
+
+    BigInterval BigInterval::operator-() const {
+        BigInterval copy = *this;
+        std::swap(copy.implementation->lower, copy.implementation->upper);
+        copy.implementation->lower.negate();
+        copy.implementation->upper.negate();
+        return copy;
+    }
+
+    BigFloat BigInterval::getLower() const {
+        BigFloat lower;
+        lower.implementation->backend = implementation->lower;
+        return lower;
+    }
+
+    BigFloat BigInterval::getUpper() const {
+        BigFloat upper;
+        upper.implementation->backend = implementation->upper;
+        return upper;
+    }
+
+    BigFloat BigInterval::getMidpoint() const {
+        BigFloat midpoint;
+        midpoint.implementation->backend = implementation->lower;
+        midpoint.implementation->backend.add(implementation->upper);
+        midpoint.implementation->backend.scaleBits(-1);
+        return midpoint;
+    }
+
+    BigFloat BigInterval::getWidth() const {
+        BigFloat width;
+        width.implementation->backend = implementation->upper;
+        width.implementation->backend.subtract(implementation->lower, implementation->getRounding(RoundingMode::UP));
+        return width;
+    }
+
+    bool BigInterval::contains(const BigFloat &value) const {
+        return implementation->lower.compare(value.implementation->backend) <= 0 &&
+               implementation->upper.compare(value.implementation->backend) >= 0;
+    }
+
+    bool BigInterval::isAccurateTo(std::size_t digitsAfterDot) const {
+        BigIntBackend<PieceType> scale(1), power(10);
+
+        for (std::size_t rest = digitsAfterDot; rest > 0; rest >>= 1) {
+            if (rest & 1) {
+                scale.multiply(power);
+            }
+
+            if (rest > 1) {
+                BigIntBackend<PieceType> square = power;
+                power.multiply(square);
+            }
+        }
+
+        // Width, which does not exceed the unit of the digit, keeps every value within half of it from the midpoint.
+        BigFloatBackend<PieceType> width = implementation->upper;
+        width.subtract(implementation->lower, implementation->getRounding(RoundingMode::UP));
+        width.multiply(BigFloatBackend<PieceType>(scale), implementation->getRounding(RoundingMode::UP));
+
+        return width.compare(BigFloatBackend<PieceType>(BigIntBackend<PieceType>(1))) <= 0;
+    }
+
+    void BigInterval::setPrecision(std::size_t precision) {
+        implementation->setBitPrecision(precision * Implementation::PIECE_BITS, false);
+    }
+
+    std::size_t BigInterval::getPrecision() const {
+        return (implementation->bitPrecision + Implementation::PIECE_BITS - 1) / Implementation::PIECE_BITS;
+    }
+
+    void BigInterval::setBitPrecision(std::size_t bitPrecision) {
+        implementation->setBitPrecision(bitPrecision, true);
+    }
+
+    std::size_t BigInterval::getBitPrecision() const {
+        return implementation->bitPrecision;
+    }
+
+    BigInterval BigInterval::pi() {
+        BigInterval value = Implementation::pi(BigFloat::getDefaultPrecision() * Implementation::PIECE_BITS +
+                                               Implementation::GUARD_BITS);
+        value.setPrecision(BigFloat::getDefaultPrecision());
+
+        return value;
+    }
+
+    BigInterval sqrt(const BigInterval &value) {
+        if (BigInterval::Implementation::isNegative(value.implementation->upper)) {
+            throw std::logic_error("Cannot take square root of negative interval.");
+        }
+
+        BigInterval root = value;
+
+        // Square root is defined only on non-negative part of interval, which comes from rounding errors around zero.
+        if (BigInterval::Implementation::isNegative(root.implementation->lower)) {
+            root.implementation->lower = BigFloatBackend<PieceType>();
+        }
+
+        root.implementation->lower.sqrt(root.implementation->getRounding(RoundingMode::DOWN));
+        root.implementation->upper.sqrt(root.implementation->getRounding(RoundingMode::UP));
+
+        return root;
+    }
+
+    BigInterval sin(const BigInterval &value) {
+        using Implementation = BigInterval::Implementation;
+
+        std::size_t bitPrecision = value.implementation->bitPrecision + Implementation::GUARD_BITS;
+
+        BigFloatBackend<PieceType> midpoint = value.implementation->lower;
+        midpoint.add(value.implementation->upper);
+        midpoint.scaleBits(-1);
+
+        BigInterval sine = Implementation::sin(midpoint, bitPrecision);
+
+        // Derivative of sine does not exceed one, so sine of interval lies within its radius from sine of midpoint.
+        BigFloatBackend<PieceType> radius = value.implementation->upper;
+        radius.subtract(midpoint, {bitPrecision, RoundingMode::UP});
+        Implementation::widen(sine, radius);
+
+        BigFloatBackend<PieceType> one(BigIntBackend<PieceType>(1)), minusOne(BigIntBackend<PieceType>(-1));
+
+        if (sine.implementation->lower.compare(minusOne) < 0) {
+            sine.implementation->lower = minusOne;
+        }
+
+        if (sine.implementation->upper.compare(one) > 0) {
+            sine.implementation->upper = one;
+        }
+
+        sine.implementation->setBitPrecision(value.implementation->bitPrecision, value.implementation->isSignificant);
+
+        return sine;
+    }
+
+    BigInterval ln(const BigInterval &value) {
+        using Implementation = BigInterval::Implementation;
+
+        if (value.implementation->lower.compare(BigFloatBackend<PieceType>()) <= 0) {
+            throw std::logic_error("Cannot take logarithm of interval, which is not positive.");
+        }
+
+        std::size_t bitPrecision = value.implementation->bitPrecision + Implementation::GUARD_BITS;
+
+        // Logarithm grows, so its bounds are logarithms of bounds.
+        BigInterval logarithm = Implementation::ln(value.implementation->lower, bitPrecision);
+
+        if (value.implementation->upper.compare(value.implementation->lower) != 0) {
+            logarithm.implementation->upper = Implementation::ln(value.implementation->upper,
+                                                                 bitPrecision).implementation->upper;
+        }
+
+        logarithm.implementation->setBitPrecision(value.implementation->bitPrecision,
+                                                  value.implementation->isSignificant);
+
+        return logarithm;
+    }
+
+    std::ostream &operator<<(std::ostream &output, const BigInterval &value) {
+        return output << '[' << value.getLower() << ", " << value.getUpper() << ']';
+    }
+}
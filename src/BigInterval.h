@@ -0,0 +1,101 @@
+#ifndef BIG_NUMBERS_BIGINTERVAL_H
+#define BIG_NUMBERS_BIGINTERVAL_H
+
+#include "BigFloat.h"
+
+#include <ostream>
+
+namespace BigNumbers {
+    // Closed interval, which is certain to contain exact result of computation. Its bounds are rounded outward to bit
+    // precision of interval, so that computation can start at a low precision and be repeated at a higher one only
+    // when resulting interval is too wide.
+    class BigInterval {
+    private:
+        class Implementation;
+
+        Implementation *implementation;
+
+        explicit BigInterval(Implementation *implementation);
+    public:
+        BigInterval();
+
+        BigInterval(const BigInterval &other);
+
+        BigInterval(const BigFloat &value);
+
+        template<class Value, typename std::enable_if<std::is_integral<Value>::value, bool>::type = false>
+        BigInterval(Value value): BigInterval(BigFloat(value)) {
+        }
+
+        // Interval [lower, upper], bounds are kept exactly.
+        BigInterval(const BigFloat &lower, const BigFloat &upper);
+
+        ~BigInterval();
+
+        BigInterval &operator=(const BigInterval &other);
+
+        BigInterval &operator+=(const BigInterval &addend);
+
+        BigInterval operator+(const BigInterval &addend) const;
+
+        BigInterval &operator-=(const BigInterval &subtrahend);
+
+        BigInterval operator-(const BigInterval &subtrahend) const;
+
+        BigInterval &operator*=(const BigInterval &multiplicand);
+
+        BigInterval operator*(const BigInterval &multiplicand) const;
+
+        BigInterval &operator/=(const BigInterval &divisor);
+
+        BigInterval operator/(const BigInterval &divisor) const;
+
+        BigInterval operator-() const;
+
+        BigFloat getLower() const;
+
+        BigFloat getUpper() const;
+
+        BigFloat getMidpoint() const;
+
+        // Upper bound of difference between bounds.
+        BigFloat getWidth() const;
+
+        bool contains(const BigFloat &value) const;
+
+        // Whether midpoint differs from any value of interval by at most half a unit of given decimal digit after the
+        // point, so that printing it with this many digits is accurate.
+        bool isAccurateTo(std::size_t digitsAfterDot) const;
+
+        // Precision in pieces and in bits, which bounds are rounded to. It is taken from default precision on creation
+        // and results of operations take precision of their left operand, same as for BigFloat. Bit precision, which is
+        // set explicitly, counts significant bits of each bound.
+        void setPrecision(std::size_t precision);
+
+        std::size_t getPrecision() const;
+
+        void setBitPrecision(std::size_t bitPrecision);
+
+        std::size_t getBitPrecision() const;
+
+        // Interval of pi at default precision.
+        static BigInterval pi();
+
+        friend BigInterval sqrt(const BigInterval &value);
+
+        friend BigInterval sin(const BigInterval &value);
+
+        friend BigInterval ln(const BigInterval &value);
+
+        // Prints bounds as "[lower, upper]" with formatting of the stream.
+        friend std::ostream &operator<<(std::ostream &output, const BigInterval &value);
+    };
+
+    BigInterval sqrt(const BigInterval &value);
+
+    BigInterval sin(const BigInterval &value);
+
+    BigInterval ln(const BigInterval &value);
+}
+
+#endif //BIG_NUMBERS_BIGINTERVAL_H
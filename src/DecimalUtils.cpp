@@ -0,0 +1,240 @@
+#include "DecimalUtils.h"
+
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "DivisionUtils.h"
+#include "config.h"
+
+namespace BigNumbers {
+    template<class T>
+    BigIntBackend<T> powerOfTen(std::size_t exponent) {
+        static thread_local std::map<std::size_t, BigIntBackend<T>> cache;
+
+        auto cached = cache.find(exponent);
+        if (cached != cache.end()) {
+            return cached->second;
+        }
+
+        BigIntBackend<T> power(1), base(10);
+
+        for (std::size_t rest = exponent; rest > 0; rest >>= 1) {
+            if (rest & 1) {
+                power.multiply(base);
+            }
+
+            if (rest > 1) {
+                BigIntBackend<T> square = base;
+                base.multiply(square);
+            }
+        }
+
+        // Printing at many different precisions must not hold all their powers.
+        if (cache.size() >= 16) {
+            cache.clear();
+        }
+
+        cache.emplace(exponent, power);
+
+        return power;
+    }
+
+    // Power of ten, which splits values into halves of digits, and its reciprocal for division of values below its
+    // square.
+    template<class T>
+    struct DecimalLevel {
+        BigIntBackend<T> power;
+        BigIntBackend<T> inverse;
+        std::size_t precision;
+        std::size_t digits;
+    };
+
+    // Digits of the largest power of ten, which fits into a piece.
+    template<class T>
+    std::size_t getPieceDigits() {
+        std::size_t digits = 0;
+
+        for (T power = 1; power <= std::numeric_limits<T>::max() / 10; power *= 10) {
+            ++digits;
+        }
+
+        return digits;
+    }
+
+    // Levels 10^(d * 2^i), which are cached for each thread and are added, until the last one exceeds square root of
+    // given value.
+    template<class T>
+    const std::vector<DecimalLevel<T>> &getDecimalLevels(const BigIntBackend<T> &value) {
+        // Values of up to this amount of pieces are converted by divisions by single piece.
+        constexpr std::size_t BASE_PIECES = 16;
+
+        static thread_local std::vector<DecimalLevel<T>> levels;
+
+        if (levels.empty()) {
+            std::size_t digits = getPieceDigits<T>() * BASE_PIECES;
+            levels.push_back({powerOfTen<T>(digits), BigIntBackend<T>(), 0, digits});
+        }
+
+        // Value is below square of the last power, when it is shorter, than both of its halves.
+        while (2 * levels.back().power.accessPieces().size() - 2 < value.accessPieces().size()) {
+            BigIntBackend<T> power = levels.back().power, square = levels.back().power;
+            power.multiply(square);
+            levels.push_back({power, BigIntBackend<T>(), 0, 2 * levels.back().digits});
+        }
+
+        // Quotient of value below square of power by power is not longer than the power.
+        for (auto &level: levels) {
+            if (level.precision == 0) {
+                level.precision = level.power.accessPieces().size() + 2;
+                level.inverse = reciprocal(level.power, level.precision);
+            }
+        }
+
+        return levels;
+    }
+
+    // Appends exactly given amount of digits of value, which is below 10^digits, by divisions by single piece.
+    template<class T>
+    void appendPieceDigits(BigIntBackend<T> value, std::size_t digits, std::string &output) {
+        std::size_t pieceDigits = getPieceDigits<T>();
+
+        T piecePower = 1;
+        for (std::size_t i = 0; i < pieceDigits; ++i) {
+            piecePower *= 10;
+        }
+
+        BigIntBackend<T> divisor(false, {piecePower});
+
+        std::string result(digits, '0');
+        auto position = static_cast<std::ptrdiff_t>(digits);
+
+        while (position > 0 && !value.accessPieces().empty()) {
+            BigIntBackend<T> remainder = value.divide(divisor);
+            uint64_t chunk = remainder.accessPieces().empty() ? 0 : remainder.accessPieces().front();
+
+            for (std::size_t i = 0; i < pieceDigits && position > 0; ++i) {
+                result[--position] = static_cast<char>('0' + chunk % 10);
+                chunk /= 10;
+            }
+        }
+
+        output += result;
+    }
+
+    // Appends exactly 2 * digits of given level of value, which is below square of its power.
+    template<class T>
+    void appendDecimal(BigIntBackend<T> value, const std::vector<DecimalLevel<T>> &levels, std::size_t level,
+                       std::string &output) {
+        const DecimalLevel<T> &split = levels[level];
+        BigIntBackend<T> remainder = divideByReciprocal(value, split.power, split.inverse, split.precision);
+
+        if (level == 0) {
+            appendPieceDigits(value, split.digits, output);
+            appendPieceDigits(remainder, split.digits, output);
+        } else {
+            appendDecimal(value, levels, level - 1, output);
+            appendDecimal(remainder, levels, level - 1, output);
+        }
+    }
+
+    template<class T>
+    std::string toDecimalString(BigIntBackend<T> value) {
+        value.normalize();
+
+        if (value.accessPieces().empty()) {
+            return "0";
+        }
+
+        const std::vector<DecimalLevel<T>> &levels = getDecimalLevels(value);
+        std::string output;
+
+        if (value.accessPieces().size() < levels.front().power.accessPieces().size()) {
+            appendPieceDigits(value, levels.front().digits, output);
+        } else {
+            std::size_t level = 0;
+            while (2 * levels[level].power.accessPieces().size() - 2 < value.accessPieces().size()) {
+                ++level;
+            }
+
+            appendDecimal(value, levels, level, output);
+        }
+
+        output.erase(0, std::min(output.find_first_not_of('0'), output.size() - 1));
+
+        return output;
+    }
+
+    // Value of digits in [begin, end), which are read by single pieces, when there are few of them.
+    template<class T>
+    BigIntBackend<T> parseDecimal(const std::string &digits, std::size_t begin, std::size_t end) {
+        // Digits of up to this amount of pieces are read by single pieces.
+        constexpr std::size_t BASE_PIECES = 16;
+
+        std::size_t pieceDigits = getPieceDigits<T>(), baseDigits = pieceDigits * BASE_PIECES;
+
+        if (end - begin > baseDigits) {
+            // Lower part takes the largest power of two of base parts, so that its power of ten is reused.
+            std::size_t lowDigits = baseDigits;
+            while (2 * lowDigits < end - begin) {
+                lowDigits *= 2;
+            }
+
+            BigIntBackend<T> value = parseDecimal<T>(digits, begin, end - lowDigits);
+            value.multiply(powerOfTen<T>(lowDigits));
+            value.add(parseDecimal<T>(digits, end - lowDigits, end));
+
+            return value;
+        }
+
+        BigIntBackend<T> value;
+
+        // The first chunk is shorter, so that others take exactly a piece of digits.
+        std::size_t chunkDigits = (end - begin) % pieceDigits;
+        if (chunkDigits == 0) {
+            chunkDigits = pieceDigits;
+        }
+
+        for (std::size_t position = begin; position < end; position += chunkDigits, chunkDigits = pieceDigits) {
+            T scale = 1, chunk = 0;
+
+            for (std::size_t i = position; i < position + chunkDigits; ++i) {
+                scale *= 10;
+                chunk = chunk * 10 + (digits[i] - '0');
+            }
+
+            value.multiply(BigIntBackend<T>(false, {scale}));
+            value.add(BigIntBackend<T>(false, {chunk}));
+        }
+
+        value.normalize();
+
+        return value;
+    }
+
+    template<class T>
+    BigIntBackend<T> fromDecimalString(const std::string &digits) {
+        return parseDecimal<T>(digits, 0, digits.size());
+    }
+
+    // Required for testing
+    template BigIntBackend<uint8_t> powerOfTen<uint8_t>(std::size_t);
+
+    template std::string toDecimalString(BigIntBackend<uint8_t>);
+
+    template BigIntBackend<uint8_t> fromDecimalString(const std::string &);
+
+    // Required for final result
+    template BigIntBackend<PieceType> powerOfTen<PieceType>(std::size_t);
+
+    template std::string toDecimalString(BigIntBackend<PieceType>);
+
+    template BigIntBackend<PieceType> fromDecimalString(const std::string &);
+
+    // Additional tests, 64-bit pieces need 128-bit products
+#ifdef __SIZEOF_INT128__
+    template std::string toDecimalString(BigIntBackend<uint64_t>);
+
+    template BigIntBackend<uint64_t> fromDecimalString(const std::string &);
+#endif
+}
@@ -0,0 +1,24 @@
+#ifndef BIG_NUMBERS_DECIMALUTILS_H
+#define BIG_NUMBERS_DECIMALUTILS_H
+
+#include <string>
+
+#include "BigIntBackend.h"
+
+namespace BigNumbers {
+    // Power 10^exponent, the last ones are cached for each thread.
+    template<class T>
+    BigIntBackend<T> powerOfTen(std::size_t exponent);
+
+    // Decimal digits of non-negative value without leading zeros. Value is split by powers of ten recursively, so that
+    // conversion costs about as much as a few products of the same size times logarithm of its size.
+    template<class T>
+    std::string toDecimalString(BigIntBackend<T> value);
+
+    // Non-negative value of given decimal digits, leading zeros are allowed. Digits are split in halves recursively and
+    // joined by products with powers of ten.
+    template<class T>
+    BigIntBackend<T> fromDecimalString(const std::string &digits);
+}
+
+#endif //BIG_NUMBERS_DECIMALUTILS_H
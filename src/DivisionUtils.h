@@ -0,0 +1,128 @@
+#ifndef BIG_NUMBERS_DIVISIONUTILS_H
+#define BIG_NUMBERS_DIVISIONUTILS_H
+
+#include <algorithm>
+#include <vector>
+
+#include "BigIntBackend.h"
+#include "Stats.h"
+
+// Division of non-negative values by Newton reciprocal, which costs about as much as a few products of the same size.
+
+namespace BigNumbers {
+    // Top count pieces of non-negative value, padded with zero pieces at the bottom, when value is shorter.
+    template<class T>
+    BigIntBackend<T> topPieces(const BigIntBackend<T> &value, std::size_t count) {
+        const std::vector<T> &pieces = value.accessPieces();
+        std::vector<T> top(pieces.end() - std::min(count, pieces.size()), pieces.end());
+        top.insert(top.begin(), count - top.size(), 0);
+
+        return BigIntBackend<T>(false, top);
+    }
+
+    // Divides value by base^count, rounding towards negative infinity.
+    template<class T>
+    void dropPieces(BigIntBackend<T> &value, std::size_t count) {
+        std::vector<T> &pieces = value.accessPieces();
+        pieces.erase(pieces.begin(), pieces.begin() + std::min(count, pieces.size()));
+    }
+
+    template<class T>
+    BigIntBackend<T> basePower(std::size_t exponent) {
+        std::vector<T> pieces(exponent, 0);
+        pieces.push_back(1);
+
+        return BigIntBackend<T>(false, pieces);
+    }
+
+    // Reciprocal of non-negative divisor as fraction with given amount of pieces: about base^precision / d, where d
+    // is divisor scaled into [1 / base, 1). It is computed with half of precision first and refined by one Newton
+    // step x + x * (1 - d * x), so working precision doubles at each level. The levels together cost about as much
+    // as a product of full precision, and the recursion depth is logarithmic, without any iteration cap.
+    template<class T>
+    BigIntBackend<T> reciprocal(const BigIntBackend<T> &divisor, std::size_t precision) {
+        // Seed of a couple of pieces is divided exactly.
+        if (precision <= 2) {
+            BigIntBackend<T> seed = basePower<T>(2 * precision + 1);
+            seed.divide(topPieces(divisor, precision + 1));
+
+            return seed;
+        }
+
+        BIG_NUMBERS_COUNT(NEWTON_ITERATIONS, 1);
+
+        std::size_t half = precision / 2 + 1;
+        BigIntBackend<T> approximation = reciprocal(divisor, half);
+
+        // d = truncated / base^(precision + 1), error = 1 - d * x scaled by base^(precision + 1 + half).
+        BigIntBackend<T> error = basePower<T>(precision + 1 + half);
+        BigIntBackend<T> product = topPieces(divisor, precision + 1);
+        product.multiply(approximation);
+        error.subtract(product);
+
+        // Correction x * error is scaled by base^(2 * half + 1 + precision), it is brought to base^precision. Only
+        // its top pieces are needed, as error is about base^(precision + 1).
+        std::size_t shift = 2 * half + 1;
+        std::size_t dropped = error.multiplyHigh(approximation, precision + 2 - half);
+
+        if (dropped > shift) {
+            error.shiftLeft((dropped - shift) * sizeof(T) * 8);
+        } else {
+            dropPieces(error, shift - dropped);
+        }
+
+        approximation.shiftLeft((precision - half) * sizeof(T) * 8);
+        approximation.add(error);
+        approximation.normalize();
+
+        return approximation;
+    }
+
+    // Divides non-negative value by positive divisor, given its reciprocal of given precision, which must exceed amount
+    // of pieces of quotient by two. Quotient is written to value, remainder is returned.
+    template<class T>
+    BigIntBackend<T> divideByReciprocal(BigIntBackend<T> &value, const BigIntBackend<T> &divisor,
+                                        const BigIntBackend<T> &inverse, std::size_t precision) {
+        // value * inverse = quotient * base^scale, only pieces above the scale and three guard pieces are computed.
+        std::size_t scale = precision + divisor.accessPieces().size();
+        std::size_t size = value.accessPieces().size() + inverse.accessPieces().size();
+        std::size_t width = size > scale ? size - scale + 4 : 4;
+
+        BigIntBackend<T> remainder = value;
+        std::size_t dropped = value.multiplyHigh(inverse, width);
+        dropPieces(value, scale - std::min(dropped, scale));
+        value.normalize();
+
+        BigIntBackend<T> product = value;
+        product.multiply(divisor);
+        remainder.subtract(product);
+        remainder.normalize();
+
+        // Approximate quotient differs from exact one by a few units.
+        while (remainder.getSign()) {
+            remainder.add(divisor);
+            value.subtract(BigIntBackend<T>(1));
+        }
+
+        while (remainder.compare(divisor) >= 0) {
+            remainder.subtract(divisor);
+            value.add(BigIntBackend<T>(1));
+        }
+
+        remainder.normalize();
+        value.normalize();
+
+        return remainder;
+    }
+
+    // Same as divideByReciprocal, but reciprocal is computed for this division only.
+    template<class T>
+    BigIntBackend<T> divideByNewton(BigIntBackend<T> &value, const BigIntBackend<T> &divisor) {
+        std::size_t size = value.accessPieces().size(), divisorSize = divisor.accessPieces().size();
+        std::size_t precision = (size > divisorSize ? size - divisorSize : 0) + 3;
+
+        return divideByReciprocal(value, divisor, reciprocal(divisor, precision), precision);
+    }
+}
+
+#endif //BIG_NUMBERS_DIVISIONUTILS_H
@@ -0,0 +1,453 @@
+#ifndef BIG_NUMBERS_FIXEDBIGINT_H
+#define BIG_NUMBERS_FIXEDBIGINT_H
+
+#include "BigInt.h"
+#include "MagnitudeUtils.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace BigNumbers {
+    template<std::size_t... Indices>
+    struct IndexSequence {
+    };
+
+    template<std::size_t Count, std::size_t... Indices>
+    struct MakeIndexSequence : MakeIndexSequence<Count - 1, Count - 1, Indices...> {
+    };
+
+    template<std::size_t... Indices>
+    struct MakeIndexSequence<0, Indices...> {
+        using type = IndexSequence<Indices...>;
+    };
+
+    // Signed integer of fixed bit width, which keeps its pieces in place and never allocates. Values are two's
+    // complement numbers, arithmetic wraps around on overflow. Loops have compile-time bounds, so they are unrolled
+    // for small widths. Division follows BigInt: quotient is truncated, remainder is taken of absolute values.
+    template<std::size_t Bits>
+    class FixedBigInt {
+    public:
+#ifdef __SIZEOF_INT128__
+        using Piece = uint64_t;
+#else
+        // Products of 64-bit pieces need 128-bit integers.
+        using Piece = uint32_t;
+#endif
+
+        static constexpr std::size_t PIECE_SIZE = sizeof(Piece) * 8;
+        static constexpr std::size_t PIECE_COUNT = Bits / PIECE_SIZE;
+
+        static_assert(Bits > 0 && Bits % 64 == 0, "Bit width must be a positive multiple of 64.");
+
+        constexpr FixedBigInt() : pieces() {
+        }
+
+        template<class Value, typename std::enable_if<std::is_integral<Value>::value, bool>::type = false>
+        constexpr FixedBigInt(Value value)
+                : FixedBigInt(value, typename MakeIndexSequence<PIECE_COUNT>::type()) {
+        }
+
+        // Throws std::logic_error if value does not fit into Bits.
+        explicit FixedBigInt(const BigInt &value);
+
+        explicit operator BigInt() const;
+
+        static constexpr std::size_t getBitWidth() {
+            return Bits;
+        }
+
+        FixedBigInt &operator+=(const FixedBigInt &addend);
+
+        FixedBigInt operator+(const FixedBigInt &addend) const;
+
+        FixedBigInt &operator++();
+
+        FixedBigInt operator++(int);
+
+        FixedBigInt &operator-=(const FixedBigInt &subtrahend);
+
+        FixedBigInt operator-(const FixedBigInt &subtrahend) const;
+
+        FixedBigInt &operator--();
+
+        FixedBigInt operator--(int);
+
+        FixedBigInt &operator*=(const FixedBigInt &multiplicand);
+
+        FixedBigInt operator*(const FixedBigInt &multiplicand) const;
+
+        FixedBigInt &operator/=(const FixedBigInt &divisor);
+
+        FixedBigInt operator/(const FixedBigInt &divisor) const;
+
+        FixedBigInt &operator%=(const FixedBigInt &divisor);
+
+        FixedBigInt operator%(const FixedBigInt &divisor) const;
+
+        FixedBigInt operator-() const;
+
+        bool operator==(const FixedBigInt &other) const;
+
+        bool operator!=(const FixedBigInt &other) const;
+
+        bool operator<(const FixedBigInt &other) const;
+
+        bool operator>(const FixedBigInt &other) const;
+
+        bool operator<=(const FixedBigInt &other) const;
+
+        bool operator>=(const FixedBigInt &other) const;
+
+        bool getSign() const;
+
+    private:
+        using Pieces = std::array<Piece, PIECE_COUNT>;
+
+        Pieces pieces;
+
+        template<class Value, std::size_t... Indices>
+        constexpr FixedBigInt(Value value, IndexSequence<Indices...>)
+                : pieces{{pieceOf(value, Indices)...}} {
+        }
+
+        // Piece of sign-extended integral value, which takes at most 64 bits.
+        template<class Value>
+        static constexpr Piece pieceOf(Value value, std::size_t index) {
+            return index * PIECE_SIZE < 64 ? static_cast<Piece>(static_cast<uint64_t>(value) >> (index * PIECE_SIZE)) :
+                   std::is_signed<Value>::value && static_cast<int64_t>(value) < 0 ? ~static_cast<Piece>(0) : 0;
+        }
+
+        Pieces magnitude() const;
+
+        // Divides magnitudes in place: dividend is replaced by quotient, remainder is returned.
+        static Pieces divideMagnitudes(Pieces &dividend, const Pieces &divisor);
+
+        // Writes remainder to given argument and returns quotient.
+        FixedBigInt divide(const FixedBigInt &divisor, FixedBigInt &remainder) const;
+
+        int compare(const FixedBigInt &other) const;
+    };
+
+    template<std::size_t Bits>
+    std::ostream &operator<<(std::ostream &output, const FixedBigInt<Bits> &value);
+
+    template<std::size_t Bits>
+    std::istream &operator>>(std::istream &input, FixedBigInt<Bits> &value);
+
+    template<std::size_t Bits>
+    constexpr std::size_t FixedBigInt<Bits>::PIECE_SIZE;
+
+    template<std::size_t Bits>
+    constexpr std::size_t FixedBigInt<Bits>::PIECE_COUNT;
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits>::FixedBigInt(const BigInt &value) : pieces() {
+        auto bytes = value.getBytes();
+
+        // Last byte only holds the sign, so it is used as filler of the remaining pieces.
+        unsigned char fill = bytes.first[bytes.second - 1];
+        std::size_t byteCount = bytes.second - 1;
+        bool isFitting = byteCount < sizeof(Pieces) ||
+                         (byteCount == sizeof(Pieces) && (bytes.first[byteCount - 1] ^ fill) >> 7 == 0);
+
+        if (isFitting) {
+            auto *target = reinterpret_cast<unsigned char *>(pieces.data());
+            std::memcpy(target, bytes.first, byteCount);
+            std::memset(target + byteCount, fill, sizeof(Pieces) - byteCount);
+        }
+        delete[] bytes.first;
+
+        if (!isFitting) {
+            throw std::logic_error("Value does not fit into bit width of FixedBigInt.");
+        }
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits>::operator BigInt() const {
+        std::array<unsigned char, sizeof(Pieces) + 1> bytes;
+
+        std::memcpy(bytes.data(), pieces.data(), sizeof(Pieces));
+        bytes.back() = getSign() ? 0xFF : 0;
+
+        return BigInt(bytes.data(), bytes.size());
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator+=(const FixedBigInt &addend) {
+        Magnitude::addInto(pieces.data(), PIECE_COUNT, addend.pieces.data(), PIECE_COUNT);
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator+(const FixedBigInt &addend) const {
+        FixedBigInt result = *this;
+        return result += addend;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator++() {
+        for (std::size_t i = 0; i < PIECE_COUNT; ++i) {
+            if (++pieces[i] != 0) {
+                break;
+            }
+        }
+
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator++(int) {
+        FixedBigInt copy = *this;
+        ++*this;
+
+        return copy;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator-=(const FixedBigInt &subtrahend) {
+        Magnitude::subtractFrom(pieces.data(), PIECE_COUNT, subtrahend.pieces.data(), PIECE_COUNT);
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator-(const FixedBigInt &subtrahend) const {
+        FixedBigInt result = *this;
+        return result -= subtrahend;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator--() {
+        for (std::size_t i = 0; i < PIECE_COUNT; ++i) {
+            if (pieces[i]-- != 0) {
+                break;
+            }
+        }
+
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator--(int) {
+        FixedBigInt copy = *this;
+        --*this;
+
+        return copy;
+    }
+
+    // Schoolbook product, which skips pieces above the width. Lower bits of two's complement product do not depend
+    // on signs of operands.
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator*=(const FixedBigInt &multiplicand) {
+        using Wide = typename DoublePiece<Piece>::type;
+
+        Pieces product{};
+
+        for (std::size_t i = 0; i < PIECE_COUNT; ++i) {
+            Wide carry = 0;
+
+            for (std::size_t j = 0; i + j < PIECE_COUNT; ++j) {
+                Wide current = static_cast<Wide>(pieces[i]) * multiplicand.pieces[j] + product[i + j] + carry;
+                product[i + j] = static_cast<Piece>(current);
+                carry = current >> PIECE_SIZE;
+            }
+        }
+
+        pieces = product;
+
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator*(const FixedBigInt &multiplicand) const {
+        FixedBigInt result = *this;
+        return result *= multiplicand;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator/=(const FixedBigInt &divisor) {
+        FixedBigInt remainder;
+        return *this = divide(divisor, remainder);
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator/(const FixedBigInt &divisor) const {
+        FixedBigInt remainder;
+        return divide(divisor, remainder);
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> &FixedBigInt<Bits>::operator%=(const FixedBigInt &divisor) {
+        divide(divisor, *this);
+        return *this;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator%(const FixedBigInt &divisor) const {
+        FixedBigInt remainder;
+        divide(divisor, remainder);
+
+        return remainder;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::operator-() const {
+        FixedBigInt result;
+        result -= *this;
+
+        return result;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator==(const FixedBigInt &other) const {
+        return pieces == other.pieces;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator!=(const FixedBigInt &other) const {
+        return pieces != other.pieces;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator<(const FixedBigInt &other) const {
+        return compare(other) < 0;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator>(const FixedBigInt &other) const {
+        return compare(other) > 0;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator<=(const FixedBigInt &other) const {
+        return compare(other) <= 0;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::operator>=(const FixedBigInt &other) const {
+        return compare(other) >= 0;
+    }
+
+    template<std::size_t Bits>
+    bool FixedBigInt<Bits>::getSign() const {
+        return pieces.back() >> (PIECE_SIZE - 1);
+    }
+
+    template<std::size_t Bits>
+    std::ostream &operator<<(std::ostream &output, const FixedBigInt<Bits> &value) {
+        return output << static_cast<BigInt>(value);
+    }
+
+    template<std::size_t Bits>
+    std::istream &operator>>(std::istream &input, FixedBigInt<Bits> &value) {
+        BigInt parsed;
+
+        if (input >> parsed) {
+            value = FixedBigInt<Bits>(parsed);
+        }
+
+        return input;
+    }
+
+    template<std::size_t Bits>
+    typename FixedBigInt<Bits>::Pieces FixedBigInt<Bits>::magnitude() const {
+        return getSign() ? (-*this).pieces : pieces;
+    }
+
+    template<std::size_t Bits>
+    typename FixedBigInt<Bits>::Pieces FixedBigInt<Bits>::divideMagnitudes(Pieces &dividend, const Pieces &divisor) {
+        using Wide = typename DoublePiece<Piece>::type;
+
+        std::size_t divisorSize = PIECE_COUNT;
+        while (divisorSize > 0 && divisor[divisorSize - 1] == 0) {
+            --divisorSize;
+        }
+
+        if (divisorSize == 0) {
+            throw std::logic_error("Cannot divide by zero.");
+        }
+
+        Pieces remainder{};
+
+        if (divisorSize == 1) {
+            Wide current = 0;
+
+            for (std::size_t i = PIECE_COUNT; i > 0; --i) {
+                current = (current << PIECE_SIZE) | dividend[i - 1];
+                dividend[i - 1] = static_cast<Piece>(current / divisor[0]);
+                current %= divisor[0];
+            }
+
+            remainder[0] = static_cast<Piece>(current);
+            return remainder;
+        }
+
+        std::size_t normalization = 0;
+        for (Piece top = divisor[divisorSize - 1]; (top >> (PIECE_SIZE - 1)) == 0; top <<= 1) {
+            ++normalization;
+        }
+
+        // Both operands are shifted, so that top bit of divisor is set. Dividend gets one more piece for the carry.
+        Pieces normalizedDivisor{};
+        std::array<Piece, PIECE_COUNT + 1> current{};
+
+        for (std::size_t i = PIECE_COUNT + 1; i > 0; --i) {
+            Piece high = i - 1 < PIECE_COUNT ? dividend[i - 1] : 0;
+            Piece low = i > 1 ? dividend[i - 2] : 0;
+            current[i - 1] = normalization == 0 ? high : (high << normalization) | (low >> (PIECE_SIZE - normalization));
+        }
+
+        for (std::size_t i = divisorSize; i > 0; --i) {
+            Piece low = i > 1 ? divisor[i - 2] : 0;
+            normalizedDivisor[i - 1] = normalization == 0 ? divisor[i - 1] :
+                                       (divisor[i - 1] << normalization) | (low >> (PIECE_SIZE - normalization));
+        }
+
+        dividend.fill(0);
+        Magnitude::divideNormalized(current.data(), current.size(), normalizedDivisor.data(), divisorSize,
+                                    dividend.data());
+
+        for (std::size_t i = 0; i < divisorSize; ++i) {
+            Piece high = i + 1 < divisorSize ? current[i + 1] : 0;
+            remainder[i] = normalization == 0 ? current[i] :
+                           (current[i] >> normalization) | (high << (PIECE_SIZE - normalization));
+        }
+
+        return remainder;
+    }
+
+    template<std::size_t Bits>
+    FixedBigInt<Bits> FixedBigInt<Bits>::divide(const FixedBigInt &divisor, FixedBigInt &remainder) const {
+        // Remainder may be this object or divisor, so signs are taken first.
+        bool isNegative = getSign() != divisor.getSign();
+
+        FixedBigInt quotient;
+        quotient.pieces = magnitude();
+        remainder.pieces = divideMagnitudes(quotient.pieces, divisor.magnitude());
+
+        return isNegative ? -quotient : quotient;
+    }
+
+    template<std::size_t Bits>
+    int FixedBigInt<Bits>::compare(const FixedBigInt &other) const {
+        if (getSign() != other.getSign()) {
+            return getSign() ? -1 : 1;
+        }
+
+        // Values of the same sign are ordered as their unsigned representations.
+        for (std::size_t i = PIECE_COUNT; i > 0; --i) {
+            if (pieces[i - 1] != other.pieces[i - 1]) {
+                return pieces[i - 1] < other.pieces[i - 1] ? -1 : 1;
+            }
+        }
+
+        return 0;
+    }
+}
+
+#endif //BIG_NUMBERS_FIXEDBIGINT_H
@@ -2,16 +2,55 @@
 #define BIG_NUMBERS_ISOMORPHICMATH_H
 
 #include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <vector>
 #include "BigInt.h"
+#include "BigIntMath.h"
+#include "Stats.h"
+#include "ThreadPool.h"
 
 namespace IsomorphicMath {
+    // Power of two, which is not less than square root of positive value and is less than twice of it. Exponent is
+    // found by squaring steps and their binary search, so only a logarithmic amount of multiplications is needed.
+    template<class T>
+    T sqrtEstimate(const T &value) {
+        std::vector<T> steps{static_cast<T>(2)};
+
+        while (steps.back() * steps.back() < value) {
+            steps.push_back(steps.back() * steps.back());
+        }
+
+        T estimate = 1;
+        for (auto step = steps.rbegin(); step != steps.rend(); ++step) {
+            T candidate = estimate * *step;
+
+            if (candidate * candidate < value) {
+                estimate = candidate;
+            }
+        }
+
+        return estimate * static_cast<T>(2);
+    }
+
     template<class T>
     T sqrt(T value, T epsilon) {
-        T x = value;
-        T y = 1;
+        if (value <= static_cast<T>(0)) {
+            return value;
+        }
+
+        T x = value < static_cast<T>(1) ? static_cast<T>(1) : sqrtEstimate(value);
+        T y = value / x;
         T two = 2;
 
         while ((x - y) > epsilon) {
+            BIG_NUMBERS_COUNT(NEWTON_ITERATIONS, 1);
+
             x += y;
             x /= two;
             y = value / x;
@@ -20,19 +59,284 @@ namespace IsomorphicMath {
         return x;
     }
 
+    // Multiplies two values modulo given modulus without overflowing 64 bits.
+    inline uint64_t mulMod64(uint64_t first, uint64_t second, uint64_t modulus) {
+#ifdef __SIZEOF_INT128__
+        return static_cast<uint64_t>(static_cast<unsigned __int128>(first) * second % modulus);
+#else
+        uint64_t result = 0;
+        first %= modulus;
+
+        while (second > 0) {
+            if (second & 1) {
+                result = result >= modulus - first ? result - (modulus - first) : result + first;
+            }
+
+            first = first >= modulus - first ? first - (modulus - first) : first + first;
+            second >>= 1;
+        }
+
+        return result;
+#endif
+    }
+
+    inline uint64_t powMod64(uint64_t base, uint64_t exponent, uint64_t modulus) {
+        uint64_t result = 1 % modulus;
+        base %= modulus;
+
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = mulMod64(result, base, modulus);
+            }
+
+            base = mulMod64(base, base, modulus);
+            exponent >>= 1;
+        }
+
+        return result;
+    }
+
+    // Deterministic Miller-Rabin test for machine-sized values. Witness sets are known to have no strong
+    // pseudoprimes below 2^32 (2, 7, 61) and below 2^64 (Sinclair's seven bases).
+    inline bool isPrime64(uint64_t value) {
+        static const uint64_t smallWitnesses[] = {2, 7, 61};
+        static const uint64_t largeWitnesses[] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+        if (value < 2) {
+            return false;
+        }
+
+        if (value < 4) {
+            return true;
+        }
+
+        if (value % 2 == 0) {
+            return false;
+        }
+
+        uint64_t oddPart = value - 1;
+        std::size_t twoPower = 0;
+        while (oddPart % 2 == 0) {
+            oddPart /= 2;
+            ++twoPower;
+        }
+
+        const uint64_t *witnesses = value < (UINT64_C(1) << 32) ? smallWitnesses : largeWitnesses;
+        std::size_t witnessCount = value < (UINT64_C(1) << 32) ? 3 : 7;
+
+        for (std::size_t i = 0; i < witnessCount; ++i) {
+            uint64_t witness = witnesses[i] % value;
+
+            if (witness == 0) {
+                continue;
+            }
+
+            uint64_t x = powMod64(witness, oddPart, value);
+            if (x == 1 || x == value - 1) {
+                continue;
+            }
+
+            bool isWitnessOfCompositeness = true;
+            for (std::size_t j = 1; j < twoPower && isWitnessOfCompositeness; ++j) {
+                x = mulMod64(x, x, value);
+
+                if (x == value - 1) {
+                    isWitnessOfCompositeness = false;
+                } else if (x == 1) {
+                    break;
+                }
+            }
+
+            if (isWitnessOfCompositeness) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Returns floor of square root of non-negative value.
+    template<class T>
+    T integerSqrt(const T &value) {
+        T two = 2;
+
+        if (value < two) {
+            return value;
+        }
+
+        T x = sqrtEstimate(value);
+        T y = (x + value / x) / two;
+
+        while (y < x) {
+            x = y;
+            y = (x + value / x) / two;
+        }
+
+        return x;
+    }
+
+    inline BigNumbers::BigInt integerSqrt(const BigNumbers::BigInt &value) {
+        return BigNumbers::isqrt(value);
+    }
+
+    // Returns binary digits of non-negative value, starting from the most significant one.
+    template<class T>
+    std::vector<bool> toBits(T value) {
+        std::vector<bool> bits;
+        T zero = 0;
+        T two = 2;
+
+        while (value > zero) {
+            bits.push_back(value % two != zero);
+            value /= two;
+        }
+
+        std::reverse(bits.begin(), bits.end());
+
+        return bits;
+    }
+
+    template<class T>
+    T powMod(T base, const T &exponent, const T &modulus) {
+        T result = static_cast<T>(1) % modulus;
+        base %= modulus;
+
+        for (bool bit: toBits(exponent)) {
+            result = result * result % modulus;
+
+            if (bit) {
+                result = result * base % modulus;
+            }
+        }
+
+        return result;
+    }
+
+    // Maps signed machine integer to its residue in range [0, modulus).
+    template<class T>
+    T residue(int64_t value, const T &modulus) {
+        T magnitude = static_cast<T>(value < 0 ? -value : value) % modulus;
+
+        if (value < 0 && magnitude != static_cast<T>(0)) {
+            return modulus - magnitude;
+        }
+
+        return magnitude;
+    }
+
+    // Jacobi symbol (a/n) for odd positive n.
+    template<class T>
+    int jacobi(T a, T n) {
+        T zero = 0;
+        T one = 1;
+        T two = 2;
+        T three = 3;
+        T four = 4;
+        T five = 5;
+        T eight = 8;
+
+        int result = 1;
+        a %= n;
+
+        while (a != zero) {
+            while (a % two == zero) {
+                a /= two;
+
+                T reduced = n % eight;
+                if (reduced == three || reduced == five) {
+                    result = -result;
+                }
+            }
+
+            std::swap(a, n);
+
+            if (a % four == three && n % four == three) {
+                result = -result;
+            }
+
+            a %= n;
+        }
+
+        return n == one ? result : 0;
+    }
+
+    // Checks whether value passes strong probable prime test to given base. Value must be odd and greater than 3,
+    // value - 1 must be equal to oddPart * 2^twoPower.
+    template<class T>
+    bool isStrongProbablePrime(const T &value, const T &base, const T &oddPart, std::size_t twoPower) {
+        T one = 1;
+        T minusOne = value - one;
+
+        if (base % value == static_cast<T>(0)) {
+            return true;
+        }
+
+        T x = powMod(base, oddPart, value);
+        if (x == one || x == minusOne) {
+            return true;
+        }
+
+        for (std::size_t i = 1; i < twoPower; ++i) {
+            x = x * x % value;
+
+            if (x == minusOne) {
+                return true;
+            }
+
+            if (x == one) {
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    // Probabilistic Miller-Rabin test. Checks base 2 and then given amount of random bases, so composite value passes
+    // with probability less than 4^-rounds.
     template<class T>
-    bool isPrime(T value) {
-        if (value == 0 || value == 1) {
+    bool millerRabin(const T &value, std::size_t rounds) {
+        static thread_local std::mt19937_64 generator(std::random_device{}());
+
+        T one = 1;
+        T two = 2;
+        T three = 3;
+
+        if (value < two) {
             return false;
         }
 
-        if (value == 2) {
+        if (value <= three) {
             return true;
         }
 
-        T squareRoot = sqrt(value, (T) 0);
-        for (T i = 2; i <= squareRoot; ++i) {
-            if (value % i == 0) {
+        if (value % two == static_cast<T>(0)) {
+            return false;
+        }
+
+        T oddPart = value - one;
+        std::size_t twoPower = 0;
+        while (oddPart % two == static_cast<T>(0)) {
+            oddPart /= two;
+            ++twoPower;
+        }
+
+        if (!isStrongProbablePrime(value, two, oddPart, twoPower)) {
+            return false;
+        }
+
+        // Random bases are taken from range [2, value - 2].
+        T range = value - three;
+        T chunk = static_cast<T>(INT64_C(1) << 32);
+
+        for (std::size_t round = 0; round < rounds; ++round) {
+            T base = 0;
+            for (T covered = 1; covered < range; covered *= chunk) {
+                base = base * chunk + static_cast<T>(static_cast<int64_t>(generator() >> 32));
+            }
+
+            base = base % range + two;
+
+            if (!isStrongProbablePrime(value, base, oddPart, twoPower)) {
                 return false;
             }
         }
@@ -40,12 +344,455 @@ namespace IsomorphicMath {
         return true;
     }
 
+    // Strong Lucas probable prime test with parameters chosen by Selfridge's method A. Value must be odd and
+    // greater than 3.
     template<class T>
-    T findNextPrime(T value) {
-        ++value;
-        while (!isPrime(value))
-            ++value;
-        return value;
+    bool isStrongLucasProbablePrime(const T &value) {
+        T zero = 0;
+        T one = 1;
+        T two = 2;
+
+        int64_t d = 5;
+        for (;;) {
+            int symbol = jacobi(residue(d, value), value);
+
+            if (symbol == -1) {
+                break;
+            }
+
+            if (symbol == 0 && static_cast<T>(d < 0 ? -d : d) != value) {
+                return false;
+            }
+
+            // Perfect squares never produce symbol -1, so stop searching once it becomes suspicious.
+            if (d == 13) {
+                T root = integerSqrt(value);
+
+                if (root * root == value) {
+                    return false;
+                }
+            }
+
+            d = d > 0 ? -(d + 2) : -(d - 2);
+        }
+
+        T discriminant = residue(d, value);
+        T q = residue((1 - d) / 4, value);
+
+        auto halve = [&value, &two, &zero](const T &x) {
+            return x % two == zero ? x / two : (x + value) / two;
+        };
+
+        auto subtractMod = [&value](const T &minuend, const T &subtrahend) {
+            return minuend >= subtrahend ? minuend - subtrahend : minuend + value - subtrahend;
+        };
+
+        T oddPart = value + one;
+        std::size_t twoPower = 0;
+        while (oddPart % two == zero) {
+            oddPart /= two;
+            ++twoPower;
+        }
+
+        std::vector<bool> bits = toBits(oddPart);
+
+        // Lucas sequences with P = 1, starting at index 1.
+        T u = one;
+        T v = one;
+        T qPower = q;
+
+        for (std::size_t i = 1; i < bits.size(); ++i) {
+            u = u * v % value;
+            v = subtractMod(v * v % value, (qPower + qPower) % value);
+            qPower = qPower * qPower % value;
+
+            if (bits[i]) {
+                T nextU = halve((u + v) % value);
+                v = halve((discriminant * u + v) % value);
+                u = nextU;
+                qPower = qPower * q % value;
+            }
+        }
+
+        if (u == zero || v == zero) {
+            return true;
+        }
+
+        for (std::size_t r = 1; r < twoPower; ++r) {
+            v = subtractMod(v * v % value, (qPower + qPower) % value);
+            qPower = qPower * qPower % value;
+
+            if (v == zero) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Baillie-PSW test: strong probable prime test to base 2 followed by strong Lucas test. No composite passing it
+    // is known, and there are none below 2^64.
+    template<class T>
+    bool bailliePSW(const T &value) {
+        T one = 1;
+        T two = 2;
+        T three = 3;
+
+        if (value < two) {
+            return false;
+        }
+
+        if (value <= three) {
+            return true;
+        }
+
+        if (value % two == static_cast<T>(0)) {
+            return false;
+        }
+
+        T oddPart = value - one;
+        std::size_t twoPower = 0;
+        while (oddPart % two == static_cast<T>(0)) {
+            oddPart /= two;
+            ++twoPower;
+        }
+
+        return isStrongProbablePrime(value, two, oddPart, twoPower) && isStrongLucasProbablePrime(value);
+    }
+
+    // Smallest value, which does not fit into 64 bits.
+    template<class T>
+    const T &uint64Limit() {
+        static const T limit = static_cast<T>(INT64_C(1) << 32) * static_cast<T>(INT64_C(1) << 32);
+
+        return limit;
+    }
+
+    // Runs primality tests on value, which is already known to have no small prime factors.
+    template<class T>
+    bool isPrimeWithoutTrialDivision(const T &value) {
+        if (value < uint64Limit<T>()) {
+            return isPrime64(static_cast<uint64_t>(value));
+        }
+
+        return bailliePSW(value);
+    }
+
+    template<class T>
+    bool isPrime(const T &value) {
+        static const int64_t smallPrimes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67,
+                                              71, 73, 79, 83, 89, 97};
+
+        if (value < static_cast<T>(2)) {
+            return false;
+        }
+
+        for (int64_t prime: smallPrimes) {
+            T divisor = static_cast<T>(prime);
+
+            if (value == divisor) {
+                return true;
+            }
+
+            if (value % divisor == static_cast<T>(0)) {
+                return false;
+            }
+        }
+
+        if (value < static_cast<T>(97 * 97)) {
+            return true;
+        }
+
+        return isPrimeWithoutTrialDivision(value);
+    }
+
+    // Default amount of consecutive integers, which are sieved at once while searching for primes.
+    constexpr std::size_t DEFAULT_SIEVE_WINDOW = 1 << 14;
+
+    // Amount of sieve windows per worker, which are searched before their primes are merged into the result.
+    constexpr std::size_t SIEVE_WINDOWS_PER_WORKER = 4;
+
+    // All primes below 2^16, in increasing order.
+    inline const std::vector<uint32_t> &smallPrimeTable() {
+        static const std::vector<uint32_t> table = []() {
+            constexpr uint32_t LIMIT = 1 << 16;
+
+            std::vector<bool> isComposite(LIMIT, false);
+            std::vector<uint32_t> primes;
+
+            for (uint32_t i = 2; i < LIMIT; ++i) {
+                if (isComposite[i]) {
+                    continue;
+                }
+
+                primes.push_back(i);
+                for (uint32_t j = i * i; j < LIMIT; j += i) {
+                    isComposite[j] = true;
+                }
+            }
+
+            return primes;
+        }();
+
+        return table;
+    }
+
+    // Mod-210 wheel: for each residue r, distance to the nearest residue not smaller than r, which is coprime to
+    // 2, 3, 5 and 7.
+    inline const std::vector<uint32_t> &wheelDistanceTable() {
+        static const std::vector<uint32_t> table = []() {
+            constexpr uint32_t WHEEL = 210;
+
+            std::vector<uint32_t> distances(WHEEL);
+            for (uint32_t residue = 0; residue < WHEEL; ++residue) {
+                uint32_t distance = 0;
+
+                for (uint32_t r = residue; r % 2 == 0 || r % 3 == 0 || r % 5 == 0 || r % 7 == 0; ++r) {
+                    ++distance;
+                }
+
+                distances[residue] = distance;
+            }
+
+            return distances;
+        }();
+
+        return table;
+    }
+
+    // Segmented sieve over consecutive windows of integers starting at given value. Candidates divisible by 2, 3, 5
+    // or 7 are skipped by the wheel, other primes from small prime table are crossed out in each window, so only
+    // survivors need full primality test. Start value must be greater than 2^16.
+    template<class T>
+    class CandidateSieve {
+    private:
+        T start;
+        std::size_t windowSize;
+        std::vector<uint32_t> residues;
+        uint32_t wheelResidue;
+
+        static constexpr uint32_t WHEEL = 210;
+        static constexpr std::size_t FIRST_SIEVING_PRIME = 4;
+
+    public:
+        CandidateSieve(const T &start, std::size_t windowSize) :
+                start(start), windowSize(windowSize), wheelResidue(0) {
+            if (windowSize == 0) {
+                throw std::logic_error("Sieve window must not be empty.");
+            }
+
+            const std::vector<uint32_t> &primes = smallPrimeTable();
+
+            residues.reserve(primes.size());
+            for (uint32_t prime: primes) {
+                residues.push_back(static_cast<uint32_t>(start % static_cast<T>(static_cast<int64_t>(prime))));
+            }
+
+            wheelResidue = static_cast<uint32_t>(start % static_cast<T>(static_cast<int64_t>(WHEEL)));
+        }
+
+        T windowStart(std::size_t window) const {
+            return start + static_cast<T>(static_cast<int64_t>(window)) * static_cast<T>(
+                    static_cast<int64_t>(windowSize));
+        }
+
+        // Offsets from window start of candidates, which have no factors in small prime table, in increasing order.
+        std::vector<std::size_t> survivors(std::size_t window) const {
+            const std::vector<uint32_t> &primes = smallPrimeTable();
+            const std::vector<uint32_t> &distances = wheelDistanceTable();
+
+            uint64_t shift = static_cast<uint64_t>(window) * windowSize;
+            std::vector<bool> isComposite(windowSize, false);
+
+            for (std::size_t i = FIRST_SIEVING_PRIME; i < primes.size(); ++i) {
+                uint64_t prime = primes[i];
+                uint64_t residue = (residues[i] + shift % prime) % prime;
+
+                for (uint64_t offset = (prime - residue) % prime; offset < windowSize; offset += prime) {
+                    isComposite[offset] = true;
+                }
+            }
+
+            uint32_t windowResidue = static_cast<uint32_t>((wheelResidue + shift % WHEEL) % WHEEL);
+
+            std::vector<std::size_t> result;
+            for (std::size_t offset = distances[windowResidue]; offset < windowSize;) {
+                if (!isComposite[offset]) {
+                    result.push_back(offset);
+                }
+
+                ++offset;
+                offset += distances[(windowResidue + offset) % WHEEL];
+            }
+
+            return result;
+        }
+    };
+
+    // Resolves requested amount of workers, where 0 stands for thread count of the shared pool.
+    inline unsigned resolveThreadCount(unsigned threadCount) {
+        return threadCount == 0 ? BigNumbers::getThreadCount() : threadCount;
+    }
+
+    // Runs worker as given amount of tasks of the shared thread pool and waits until all of them finish, so at most
+    // thread count of the pool run at once. Single worker runs on the calling thread. First exception thrown by any
+    // worker is rethrown.
+    template<class Worker>
+    void runWorkers(unsigned threadCount, const Worker &worker) {
+        if (threadCount <= 1) {
+            worker();
+            return;
+        }
+
+        BigNumbers::ThreadPool::TaskGroup group;
+
+        for (unsigned i = 0; i < threadCount; ++i) {
+            group.run([&worker]() {
+                worker();
+            });
+        }
+
+        group.wait();
+    }
+
+    // Finds smallest prime greater than value. Sieve windows are handed out to worker threads in increasing order;
+    // once prime is found in some window, workers abandon all windows after it, and the prime from the lowest window
+    // wins.
+    template<class T>
+    T findNextPrime(T value, std::size_t windowSize = DEFAULT_SIEVE_WINDOW, unsigned threadCount = 1) {
+        const std::vector<uint32_t> &primes = smallPrimeTable();
+
+        if (value < static_cast<T>(2)) {
+            return static_cast<T>(2);
+        }
+
+        if (value < static_cast<T>(static_cast<int64_t>(primes.back()))) {
+            auto next = std::upper_bound(primes.begin(), primes.end(), static_cast<uint32_t>(value));
+
+            return static_cast<T>(static_cast<int64_t>(*next));
+        }
+
+        CandidateSieve<T> sieve(value + static_cast<T>(1), windowSize);
+
+        std::atomic<std::size_t> nextWindow(0);
+        std::atomic<std::size_t> foundWindow(std::numeric_limits<std::size_t>::max());
+        std::mutex resultMutex;
+        T result;
+
+        runWorkers(resolveThreadCount(threadCount), [&]() {
+            for (;;) {
+                std::size_t window = nextWindow++;
+
+                if (window > foundWindow.load()) {
+                    return;
+                }
+
+                T windowStart = sieve.windowStart(window);
+
+                for (std::size_t offset: sieve.survivors(window)) {
+                    if (window > foundWindow.load()) {
+                        return;
+                    }
+
+                    T candidate = windowStart + static_cast<T>(static_cast<int64_t>(offset));
+
+                    if (isPrimeWithoutTrialDivision(candidate)) {
+                        std::lock_guard<std::mutex> lock(resultMutex);
+
+                        if (window < foundWindow.load()) {
+                            foundWindow = window;
+                            result = candidate;
+                        }
+
+                        return;
+                    }
+                }
+            }
+        });
+
+        return result;
+    }
+
+    // Finds all primes in range [from, to] in increasing order. Sieve windows are tested on worker threads
+    // independently in batches of a few windows per worker, each batch is concatenated in order before the next one
+    // starts, so that only primes of one batch are held apart from the result.
+    template<class T>
+    std::vector<T> findPrimesInRange(T from, const T &to, std::size_t windowSize = DEFAULT_SIEVE_WINDOW,
+                                     unsigned threadCount = 1) {
+        const std::vector<uint32_t> &primes = smallPrimeTable();
+        const T sieveStart = static_cast<T>(INT64_C(1) << 16);
+
+        std::vector<T> result;
+
+        if (from < static_cast<T>(2)) {
+            from = static_cast<T>(2);
+        }
+
+        if (to < from) {
+            return result;
+        }
+
+        if (from < sieveStart) {
+            auto first = std::lower_bound(primes.begin(), primes.end(), static_cast<uint32_t>(from));
+
+            for (auto prime = first; prime != primes.end(); ++prime) {
+                T value = static_cast<T>(static_cast<int64_t>(*prime));
+
+                if (value > to) {
+                    return result;
+                }
+
+                result.push_back(value);
+            }
+
+            from = sieveStart;
+
+            if (to < from) {
+                return result;
+            }
+        }
+
+        CandidateSieve<T> sieve(from, windowSize);
+
+        T windowSizeValue = static_cast<T>(static_cast<int64_t>(windowSize));
+        auto windowCount = static_cast<std::size_t>(static_cast<uint64_t>((to - from) / windowSizeValue)) + 1;
+
+        unsigned workerCount = resolveThreadCount(threadCount);
+        std::size_t batchSize = std::min<std::size_t>(windowCount, workerCount * SIEVE_WINDOWS_PER_WORKER);
+
+        std::vector<std::vector<T>> windowPrimes(batchSize);
+
+        for (std::size_t batchStart = 0; batchStart < windowCount; batchStart += batchSize) {
+            std::size_t batchEnd = std::min(windowCount, batchStart + batchSize);
+            std::atomic<std::size_t> nextWindow(batchStart);
+
+            runWorkers(workerCount, [&]() {
+                for (std::size_t window = nextWindow++; window < batchEnd; window = nextWindow++) {
+                    T windowStart = sieve.windowStart(window);
+
+                    for (std::size_t offset: sieve.survivors(window)) {
+                        T candidate = windowStart + static_cast<T>(static_cast<int64_t>(offset));
+
+                        if (candidate > to) {
+                            break;
+                        }
+
+                        if (isPrimeWithoutTrialDivision(candidate)) {
+                            windowPrimes[window - batchStart].push_back(candidate);
+                        }
+                    }
+                }
+            });
+
+            for (std::size_t window = batchStart; window < batchEnd; ++window) {
+                std::vector<T> &current = windowPrimes[window - batchStart];
+
+                result.insert(result.end(), current.begin(), current.end());
+                current.clear();
+            }
+        }
+
+        return result;
     }
 
     template<class T>
@@ -57,29 +804,332 @@ namespace IsomorphicMath {
         }
     }
 
+    // Factorials up to this argument are computed by plain multiplication.
+    constexpr std::size_t SMALL_FACTORIAL_LIMIT = 20;
+
+    // All primes up to given limit (sieve of Eratosthenes).
+    inline std::vector<uint64_t> primesUpTo(std::size_t limit) {
+        std::vector<uint64_t> primes;
+
+        if (limit < 2) {
+            return primes;
+        }
+
+        std::vector<bool> isComposite(limit + 1, false);
+
+        for (std::size_t i = 2; i <= limit; ++i) {
+            if (isComposite[i]) {
+                continue;
+            }
+
+            primes.push_back(i);
+            if (i > limit / i) {
+                continue;
+            }
+
+            for (std::size_t j = i * i; j <= limit; j += i) {
+                isComposite[j] = true;
+            }
+        }
+
+        return primes;
+    }
+
+    // Exponent of prime in n! (Legendre's formula).
+    inline std::size_t factorialExponent(std::size_t n, uint64_t prime) {
+        std::size_t exponent = 0;
+
+        for (; n > 0; n /= prime) {
+            exponent += n / prime;
+        }
+
+        return exponent;
+    }
+
+    // Product of factors in range [begin, end), which is split in halves, so that multiplied values have similar
+    // sizes.
+    template<class T>
+    T balancedProduct(const std::vector<uint64_t> &factors, std::size_t begin, std::size_t end) {
+        if (end - begin <= 4) {
+            T result = 1;
+            for (std::size_t i = begin; i < end; ++i) {
+                result *= static_cast<T>(static_cast<int64_t>(factors[i]));
+            }
+
+            return result;
+        }
+
+        std::size_t middle = begin + (end - begin) / 2;
+
+        return balancedProduct<T>(factors, begin, middle) * balancedProduct<T>(factors, middle, end);
+    }
+
+    // Product of prime^exponent(prime) over all primes up to given limit. Prime powers are packed into 63-bit words
+    // first and then multiplied by balanced product.
+    template<class T, class Exponent>
+    T primePowerProduct(std::size_t limit, Exponent exponent) {
+        constexpr uint64_t WORD_LIMIT = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+
+        std::vector<uint64_t> factors;
+        uint64_t word = 1;
+
+        for (uint64_t prime: primesUpTo(limit)) {
+            for (std::size_t count = exponent(prime); count > 0; --count) {
+                if (word > WORD_LIMIT / prime) {
+                    factors.push_back(word);
+                    word = 1;
+                }
+
+                word *= prime;
+            }
+        }
+
+        factors.push_back(word);
+
+        return balancedProduct<T>(factors, 0, factors.size());
+    }
+
+    // Swinging factorial n! / (floor(n / 2)!)^2. Exponent of each prime is the amount of odd values among
+    // floor(n / prime^i).
+    template<class T>
+    T primeSwing(std::size_t n) {
+        return primePowerProduct<T>(n, [n](uint64_t prime) {
+            std::size_t exponent = 0;
+
+            for (std::size_t quotient = n / prime; quotient > 0; quotient /= prime) {
+                exponent += quotient & 1;
+            }
+
+            return exponent;
+        });
+    }
+
+    // Prime swing algorithm: n! = (floor(n / 2)!)^2 * swing(n), so the work is dominated by a few balanced
+    // multiplications of large values.
     template<class T>
     T factorial(std::size_t n) {
-        T value = (T) 1;
-        for (std::size_t i = 2; i <= n; ++i) {
-            value *= (T) i;
+        if (n <= SMALL_FACTORIAL_LIMIT) {
+            T value = (T) 1;
+            for (std::size_t i = 2; i <= n; ++i) {
+                value *= (T) i;
+            }
+
+            return value;
         }
 
-        return value;
+        T half = factorial<T>(n / 2);
+
+        return half * half * primeSwing<T>(n);
+    }
+
+    // Product of all positive values up to n, which have the same parity as n.
+    template<class T>
+    T doubleFactorial(std::size_t n) {
+        if (n % 2 == 0) {
+            std::size_t half = n / 2;
+
+            // n!! = 2^k * k!, where k = n / 2.
+            return primePowerProduct<T>(std::max<std::size_t>(half, 2), [half](uint64_t prime) {
+                return factorialExponent(half, prime) + (prime == 2 ? half : 0);
+            });
+        }
+
+        // n!! = n! / (2^k * k!), where k = floor(n / 2).
+        std::size_t half = n / 2;
+
+        return primePowerProduct<T>(n, [n, half](uint64_t prime) {
+            return prime == 2 ? 0 : factorialExponent(n, prime) - factorialExponent(half, prime);
+        });
     }
 
+    // Binomial coefficient, computed from its prime factorization (Kummer's theorem).
     template<class T>
-    T pow(T value, int power) {
-        if (power < 0) {
-            throw std::logic_error("Cannot raise value to a negative power.");
+    T binomial(std::size_t n, std::size_t k) {
+        if (k > n) {
+            return 0;
         }
 
-        if (power == 0) {
+        return primePowerProduct<T>(n, [n, k](uint64_t prime) {
+            return factorialExponent(n, prime) - factorialExponent(k, prime) - factorialExponent(n - k, prime);
+        });
+    }
+
+    // Width of exponent windows, which are processed with single multiplication by precomputed odd power.
+    inline std::size_t powWindowWidth(std::size_t bitCount) {
+        return bitCount <= 8 ? 1 : bitCount <= 24 ? 2 : bitCount <= 80 ? 3 : bitCount <= 240 ? 4 : 5;
+    }
+
+    // Left-to-right sliding window exponentiation. Exponent is given by binary digits, starting from the most
+    // significant one.
+    template<class T>
+    T pow(const T &value, const std::vector<bool> &bits) {
+        if (bits.empty()) {
             return 1;
         }
 
-        T multiplier = value;
-        for (int i = 1; i < power; ++i) {
-            value *= multiplier;
+        std::size_t width = powWindowWidth(bits.size());
+
+        // Odd powers value^1, value^3, ..., value^(2^width - 1).
+        std::vector<T> oddPowers{value};
+        if (width > 1) {
+            T square = value * value;
+
+            for (std::size_t i = 1; i < (std::size_t{1} << (width - 1)); ++i) {
+                oddPowers.push_back(oddPowers.back() * square);
+            }
+        }
+
+        T result = 1;
+        bool isOne = true;
+
+        for (std::size_t i = 0; i < bits.size();) {
+            if (!bits[i]) {
+                if (!isOne) {
+                    result *= result;
+                }
+
+                ++i;
+                continue;
+            }
+
+            // Longest window starting at current bit, which ends with set bit.
+            std::size_t end = std::min(i + width, bits.size());
+            while (!bits[end - 1]) {
+                --end;
+            }
+
+            std::size_t window = 0;
+            for (std::size_t j = i; j < end; ++j) {
+                if (!isOne) {
+                    result *= result;
+                }
+
+                window = window << 1 | (bits[j] ? 1 : 0);
+            }
+
+            if (isOne) {
+                result = oddPowers[window / 2];
+                isOne = false;
+            } else {
+                result *= oddPowers[window / 2];
+            }
+
+            i = end;
+        }
+
+        return result;
+    }
+
+    // Negative powers are computed as reciprocal of positive ones.
+    template<class T>
+    T pow(const T &value, int64_t power) {
+        auto magnitude = power < 0 ? static_cast<uint64_t>(-(power + 1)) + 1 : static_cast<uint64_t>(power);
+
+        std::vector<bool> bits;
+        for (; magnitude > 0; magnitude >>= 1) {
+            bits.push_back(magnitude & 1);
+        }
+
+        std::reverse(bits.begin(), bits.end());
+
+        T result = pow(value, bits);
+
+        return power < 0 ? static_cast<T>(1) / result : result;
+    }
+
+    template<class T>
+    T pow(const T &value, int power) {
+        return pow(value, static_cast<int64_t>(power));
+    }
+
+    template<class T>
+    T pow(const T &value, const BigNumbers::BigInt &power) {
+        BigNumbers::BigInt zero = 0;
+        T result = pow(value, toBits(power < zero ? -power : power));
+
+        return power < zero ? static_cast<T>(1) / result : result;
+    }
+
+    // Product of two polynomials of degree below coefficient count, reduced modulo characteristic polynomial of
+    // recurrence a(i) = coefficients[0] * a(i - 1) + ... + coefficients[k - 1] * a(i - k). Square of polynomial
+    // computes each cross product once.
+    template<class T>
+    std::vector<T> multiplyModRecurrence(const std::vector<T> &first, const std::vector<T> &second,
+                                         const std::vector<T> &coefficients) {
+        std::size_t order = coefficients.size();
+        std::vector<T> product(2 * order - 1, static_cast<T>(0));
+
+        if (&first == &second) {
+            for (std::size_t i = 0; i < order; ++i) {
+                product[2 * i] += first[i] * first[i];
+
+                for (std::size_t j = i + 1; j < order; ++j) {
+                    T cross = first[i] * first[j];
+                    product[i + j] += cross + cross;
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i < order; ++i) {
+                for (std::size_t j = 0; j < order; ++j) {
+                    product[i + j] += first[i] * second[j];
+                }
+            }
+        }
+
+        // x^d = coefficients[0] * x^(d - 1) + ... + coefficients[k - 1] * x^(d - k)
+        for (std::size_t degree = 2 * order - 2; degree >= order; --degree) {
+            for (std::size_t j = 0; j < order; ++j) {
+                product[degree - 1 - j] += product[degree] * coefficients[j];
+            }
+        }
+
+        product.resize(order);
+
+        return product;
+    }
+
+    // n-th term of linear recurrence a(i) = coefficients[0] * a(i - 1) + ... + coefficients[k - 1] * a(i - k), which
+    // starts with given k initial values. x^n is reduced modulo characteristic polynomial by square-and-multiply
+    // (Kitamasa's method), so it takes O(k^2 log n) multiplications instead of n steps of recurrence.
+    template<class T>
+    T linearRecurrence(const std::vector<T> &coefficients, const std::vector<T> &initialValues, uint64_t n) {
+        std::size_t order = coefficients.size();
+
+        if (order == 0 || initialValues.size() != order) {
+            throw std::logic_error("Recurrence must have as many initial values as coefficients.");
+        }
+
+        if (n < order) {
+            return initialValues[n];
+        }
+
+        // Polynomial x, or coefficients themselves for recurrence of first order.
+        std::vector<T> base(order, static_cast<T>(0));
+        if (order > 1) {
+            base[1] = 1;
+        } else {
+            base[0] = coefficients[0];
+        }
+
+        std::vector<T> result(order, static_cast<T>(0));
+        result[0] = 1;
+
+        int top = 63;
+        while (((n >> top) & 1) == 0) {
+            --top;
+        }
+
+        for (int bit = top; bit >= 0; --bit) {
+            result = multiplyModRecurrence(result, result, coefficients);
+
+            if ((n >> bit) & 1) {
+                result = multiplyModRecurrence(result, base, coefficients);
+            }
+        }
+
+        T value = 0;
+        for (std::size_t i = 0; i < order; ++i) {
+            value += result[i] * initialValues[i];
         }
 
         return value;
@@ -121,12 +1171,24 @@ namespace IsomorphicMath {
         T thirdConstant = 396;
         int iterationCount = digitsAfterDot / 8 + 1;
 
+        // (4i)!, i!^4 and 396^(4i) are updated from previous iteration.
+        T numeratorFactorial = 1;
+        T denominator = 1;
+        T step = pow(thirdConstant, 4);
+
         for (int i = 0; i < iterationCount; ++i) {
-            T value = factorial<T>(4 * i) * (firstConstant + secondConstant * i);
-            T v1 = factorial<T>(i);
-            T secondValue = v1 * v1 * v1 * v1 * pow(thirdConstant, 4 * i);
+            if (i > 0) {
+                for (int j = 4 * i - 3; j <= 4 * i; ++j) {
+                    numeratorFactorial *= static_cast<T>(j);
+                }
+
+                T index = i;
+                denominator *= index * index * index * index * step;
+            }
+
+            T value = numeratorFactorial * (firstConstant + secondConstant * i);
 
-            sum += value / secondValue;
+            sum += value / denominator;
         }
 
         T constant = (static_cast<T>(2) * sqrt<T>(static_cast<T>(2), epsilon)) / static_cast<T>(9801);
@@ -0,0 +1,269 @@
+#ifndef BIG_NUMBERS_LITERALS_H
+#define BIG_NUMBERS_LITERALS_H
+
+#include "BigFloat.h"
+#include "BigInt.h"
+
+// User-defined literals 123_bi and 1.5e-3_bf. Digits are converted to little-endian bytes by the compiler, so at run
+// time constant is copied from a static array without parsing.
+
+namespace BigNumbers {
+    namespace LiteralParsing {
+        // Non-negative value as little-endian bytes, without trailing zero bytes.
+        template<unsigned char... Bytes>
+        struct ByteSequence {
+            static BigInt toBigInt() {
+                // Trailing zero is a sign byte.
+                unsigned char bytes[] = {Bytes..., 0};
+                return BigInt(bytes, sizeof(bytes));
+            }
+
+            // Lowest fractionSize bytes lie after the point.
+            static BigFloat toBigFloat(std::size_t fractionSize) {
+                unsigned char bytes[] = {Bytes..., 0};
+                return BigFloat(bytes, sizeof(bytes), fractionSize);
+            }
+        };
+
+        template<unsigned char Byte, class Sequence>
+        struct Prepend;
+
+        template<unsigned char Byte, unsigned char... Bytes>
+        struct Prepend<Byte, ByteSequence<Bytes...>> {
+            using type = ByteSequence<Byte, Bytes...>;
+        };
+
+        // Sequence * Multiplier + Carry.
+        template<unsigned Multiplier, unsigned Carry, class Sequence>
+        struct MultiplyAdd;
+
+        template<unsigned Multiplier>
+        struct MultiplyAdd<Multiplier, 0, ByteSequence<>> {
+            using type = ByteSequence<>;
+        };
+
+        template<unsigned Multiplier, unsigned Carry>
+        struct MultiplyAdd<Multiplier, Carry, ByteSequence<>> {
+            using type = typename Prepend<Carry % 256,
+                    typename MultiplyAdd<Multiplier, Carry / 256, ByteSequence<>>::type>::type;
+        };
+
+        template<unsigned Multiplier, unsigned Carry, unsigned char First, unsigned char... Rest>
+        struct MultiplyAdd<Multiplier, Carry, ByteSequence<First, Rest...>> {
+            static constexpr unsigned VALUE = First * Multiplier + Carry;
+
+            using type = typename Prepend<VALUE % 256,
+                    typename MultiplyAdd<Multiplier, VALUE / 256, ByteSequence<Rest...>>::type>::type;
+        };
+
+        // Sequence / Divisor, which may leave zero top bytes.
+        template<unsigned Divisor, class Sequence>
+        struct DivideSmall;
+
+        template<unsigned Divisor>
+        struct DivideSmall<Divisor, ByteSequence<>> {
+            using type = ByteSequence<>;
+            static constexpr unsigned REMAINDER = 0;
+        };
+
+        template<unsigned Divisor, unsigned char First, unsigned char... Rest>
+        struct DivideSmall<Divisor, ByteSequence<First, Rest...>> {
+            using Higher = DivideSmall<Divisor, ByteSequence<Rest...>>;
+
+            static constexpr unsigned CURRENT = Higher::REMAINDER * 256 + First;
+            static constexpr unsigned REMAINDER = CURRENT % Divisor;
+
+            using type = typename Prepend<CURRENT / Divisor, typename Higher::type>::type;
+        };
+
+        constexpr unsigned digitValue(char digit) {
+            return digit >= 'a' ? digit - 'a' + 10 : digit >= 'A' ? digit - 'A' + 10 : digit - '0';
+        }
+
+        template<unsigned Base, class Sequence, char... Digits>
+        struct ParseDigits {
+            using type = Sequence;
+        };
+
+        template<unsigned Base, class Sequence, char First, char... Rest>
+        struct ParseDigits<Base, Sequence, First, Rest...> {
+            static_assert(digitValue(First) < Base, "Invalid digit in literal.");
+
+            using type = typename ParseDigits<Base,
+                    typename MultiplyAdd<Base, digitValue(First), Sequence>::type, Rest...>::type;
+        };
+
+        // Integer literal with optional prefix of its base.
+        template<char... Digits>
+        struct ParseInteger {
+            using type = typename ParseDigits<10, ByteSequence<>, Digits...>::type;
+        };
+
+        template<char... Digits>
+        struct ParseInteger<'0', Digits...> {
+            using type = typename ParseDigits<8, ByteSequence<>, Digits...>::type;
+        };
+
+        template<char... Digits>
+        struct ParseInteger<'0', 'x', Digits...> {
+            using type = typename ParseDigits<16, ByteSequence<>, Digits...>::type;
+        };
+
+        template<char... Digits>
+        struct ParseInteger<'0', 'X', Digits...> {
+            using type = typename ParseDigits<16, ByteSequence<>, Digits...>::type;
+        };
+
+        template<char... Digits>
+        struct ParseInteger<'0', 'b', Digits...> {
+            using type = typename ParseDigits<2, ByteSequence<>, Digits...>::type;
+        };
+
+        template<char... Digits>
+        struct ParseInteger<'0', 'B', Digits...> {
+            using type = typename ParseDigits<2, ByteSequence<>, Digits...>::type;
+        };
+
+        // Sequence * 10^Count.
+        template<class Sequence, unsigned Count>
+        struct ScaleByTen {
+            using type = typename ScaleByTen<typename MultiplyAdd<10, 0, Sequence>::type, Count - 1>::type;
+        };
+
+        template<class Sequence>
+        struct ScaleByTen<Sequence, 0> {
+            using type = Sequence;
+        };
+
+        template<char... Digits>
+        struct ParseExponent {
+            static constexpr int VALUE = 0;
+        };
+
+        template<char First, char... Rest>
+        struct ParseExponent<First, Rest...> {
+            static constexpr int VALUE = static_cast<int>(digitValue(First) * ParseExponent<Rest...>::SCALE) +
+                                         ParseExponent<Rest...>::VALUE;
+            static constexpr int SCALE = 10 * ParseExponent<Rest...>::SCALE;
+        };
+
+        template<>
+        struct ParseExponent<> {
+            static constexpr int VALUE = 0;
+            static constexpr int SCALE = 1;
+        };
+
+        template<char... Rest>
+        struct ParseExponent<'-', Rest...> {
+            static constexpr int VALUE = -ParseExponent<Rest...>::VALUE;
+        };
+
+        template<char... Rest>
+        struct ParseExponent<'+', Rest...> {
+            static constexpr int VALUE = ParseExponent<Rest...>::VALUE;
+        };
+
+        // Decimal floating literal: mantissa digits and decimal exponent, which accounts for digits after the dot.
+        template<class Sequence, int Exponent, bool IsFraction, char... Characters>
+        struct ParseFloat {
+            using mantissa = Sequence;
+            static constexpr int EXPONENT = Exponent;
+        };
+
+        template<class Sequence, int Exponent, bool IsFraction, char... Rest>
+        struct ParseFloat<Sequence, Exponent, IsFraction, '.', Rest...>
+                : ParseFloat<Sequence, Exponent, true, Rest...> {
+        };
+
+        template<class Sequence, int Exponent, bool IsFraction, char... Rest>
+        struct ParseFloat<Sequence, Exponent, IsFraction, 'e', Rest...>
+                : ParseFloat<Sequence, Exponent + ParseExponent<Rest...>::VALUE, IsFraction> {
+        };
+
+        template<class Sequence, int Exponent, bool IsFraction, char... Rest>
+        struct ParseFloat<Sequence, Exponent, IsFraction, 'E', Rest...>
+                : ParseFloat<Sequence, Exponent + ParseExponent<Rest...>::VALUE, IsFraction> {
+        };
+
+        template<class Sequence, int Exponent, bool IsFraction, char First, char... Rest>
+        struct ParseFloat<Sequence, Exponent, IsFraction, First, Rest...>
+                : ParseFloat<typename MultiplyAdd<10, digitValue(First), Sequence>::type,
+                        Exponent - IsFraction, IsFraction, Rest...> {
+            static_assert(First >= '0' && First <= '9', "Only decimal floating literals are supported.");
+        };
+
+        // Sequence / 5^Count, if it is divisible.
+        template<class Sequence, unsigned Count, bool IsDivisible = DivideSmall<5, Sequence>::REMAINDER == 0>
+        struct DivideByFivePower {
+            using Next = DivideByFivePower<typename DivideSmall<5, Sequence>::type, Count - 1>;
+            using type = typename Next::type;
+
+            static constexpr bool IS_EXACT = Next::IS_EXACT;
+        };
+
+        template<class Sequence, unsigned Count>
+        struct DivideByFivePower<Sequence, Count, false> {
+            using type = Sequence;
+            static constexpr bool IS_EXACT = false;
+        };
+
+        template<class Sequence, bool IsDivisible>
+        struct DivideByFivePower<Sequence, 0, IsDivisible> {
+            using type = Sequence;
+            static constexpr bool IS_EXACT = true;
+        };
+
+        template<class Sequence>
+        struct DivideByFivePower<Sequence, 0, false> {
+            using type = Sequence;
+            static constexpr bool IS_EXACT = true;
+        };
+
+        // Mantissa / 10^Count. Binary fractions, such as 0.5 or 1.375, are exact: mantissa / 5^Count is shifted, so
+        // that the point lies between bytes. Other values are divided at run time with current precision.
+        template<class Mantissa, unsigned Count, bool IsExact = DivideByFivePower<Mantissa, Count>::IS_EXACT>
+        struct DecimalFraction {
+            static constexpr unsigned FRACTION_SIZE = (Count + 7) / 8;
+
+            using type = typename MultiplyAdd<1u << (FRACTION_SIZE * 8 - Count), 0,
+                    typename DivideByFivePower<Mantissa, Count>::type>::type;
+
+            static BigFloat toBigFloat() {
+                return type::toBigFloat(FRACTION_SIZE);
+            }
+        };
+
+        template<class Mantissa, unsigned Count>
+        struct DecimalFraction<Mantissa, Count, false> {
+            static BigFloat toBigFloat() {
+                return Mantissa::toBigFloat(0) / ScaleByTen<ByteSequence<1>, Count>::type::toBigFloat(0);
+            }
+        };
+
+        template<class Mantissa, int Exponent, bool IsNegative = (Exponent < 0)>
+        struct ScaledFloat {
+            static BigFloat toBigFloat() {
+                return ScaleByTen<Mantissa, Exponent>::type::toBigFloat(0);
+            }
+        };
+
+        template<class Mantissa, int Exponent>
+        struct ScaledFloat<Mantissa, Exponent, true> : DecimalFraction<Mantissa, -Exponent> {
+        };
+    }
+
+    inline namespace Literals {
+        template<char... Digits>
+        BigInt operator "" _bi() {
+            return LiteralParsing::ParseInteger<Digits...>::type::toBigInt();
+        }
+
+        template<char... Characters>
+        BigFloat operator "" _bf() {
+            using Parsed = LiteralParsing::ParseFloat<LiteralParsing::ByteSequence<>, 0, false, Characters...>;
+            return LiteralParsing::ScaledFloat<typename Parsed::mantissa, Parsed::EXPONENT>::toBigFloat();
+        }
+    }
+}
+
+#endif //BIG_NUMBERS_LITERALS_H
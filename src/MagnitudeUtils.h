@@ -0,0 +1,831 @@
+#ifndef BIG_NUMBERS_MAGNITUDEUTILS_H
+#define BIG_NUMBERS_MAGNITUDEUTILS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+
+#include "Stats.h"
+#include "ThreadPool.h"
+
+// Routines for unsigned magnitudes: vectors of pieces in little-endian order, without trailing zero pieces.
+
+namespace BigNumbers {
+    // Unsigned type, which is able to hold product of two pieces.
+    template<class T>
+    struct DoublePiece;
+
+    template<>
+    struct DoublePiece<uint8_t> {
+        using type = uint16_t;
+    };
+
+    template<>
+    struct DoublePiece<uint16_t> {
+        using type = uint32_t;
+    };
+
+    template<>
+    struct DoublePiece<uint32_t> {
+        using type = uint64_t;
+    };
+
+#ifdef __SIZEOF_INT128__
+    template<>
+    struct DoublePiece<uint64_t> {
+        using type = unsigned __int128;
+    };
+#endif
+
+    namespace Magnitude {
+        // Operands shorter than this amount of pieces are multiplied by schoolbook method.
+        constexpr std::size_t KARATSUBA_THRESHOLD = 32;
+
+        template<class T>
+        constexpr std::size_t pieceSize() {
+            return sizeof(T) * 8;
+        }
+
+        template<class T>
+        void trim(std::vector<T> &value) {
+            while (!value.empty() && value.back() == 0) {
+                value.pop_back();
+            }
+        }
+
+        template<class T>
+        bool isZero(const std::vector<T> &value) {
+            return value.empty();
+        }
+
+        template<class T>
+        std::vector<T> fromUint64(uint64_t value) {
+            std::vector<T> result;
+
+            while (value > 0) {
+                result.push_back(static_cast<T>(value));
+                value = pieceSize<T>() < 64 ? value >> (pieceSize<T>() % 64) : 0;
+            }
+
+            return result;
+        }
+
+        // Lowest 64 bits of value.
+        template<class T>
+        uint64_t toUint64(const std::vector<T> &value) {
+            uint64_t result = 0;
+
+            for (std::size_t i = 0; i < value.size() && i * pieceSize<T>() < 64; ++i) {
+                result |= static_cast<uint64_t>(value[i]) << (i * pieceSize<T>());
+            }
+
+            return result;
+        }
+
+        template<class T>
+        int compare(const std::vector<T> &first, const std::vector<T> &second) {
+            if (first.size() != second.size()) {
+                return first.size() > second.size() ? 1 : -1;
+            }
+
+            for (std::size_t i = first.size(); i > 0; --i) {
+                if (first[i - 1] != second[i - 1]) {
+                    return first[i - 1] > second[i - 1] ? 1 : -1;
+                }
+            }
+
+            return 0;
+        }
+
+        template<class T>
+        std::size_t bitLength(const std::vector<T> &value) {
+            if (value.empty()) {
+                return 0;
+            }
+
+            std::size_t length = (value.size() - 1) * pieceSize<T>();
+            for (T top = value.back(); top != 0; top >>= 1) {
+                ++length;
+            }
+
+            return length;
+        }
+
+        template<class T>
+        bool testBit(const std::vector<T> &value, std::size_t bit) {
+            std::size_t piece = bit / pieceSize<T>();
+
+            return piece < value.size() && ((value[piece] >> (bit % pieceSize<T>())) & 1);
+        }
+
+        // Amount of zero bits below the lowest set bit. Value must not be zero.
+        template<class T>
+        std::size_t countTrailingZeros(const std::vector<T> &value) {
+            std::size_t count = 0;
+            std::size_t piece = 0;
+
+            while (value[piece] == 0) {
+                ++piece;
+                count += pieceSize<T>();
+            }
+
+            for (T current = value[piece]; (current & 1) == 0; current >>= 1) {
+                ++count;
+            }
+
+            return count;
+        }
+
+        // Adds range [addend, addend + addendSize) to range [target, target + targetSize). Returns carry.
+        template<class T>
+        T addInto(T *target, std::size_t targetSize, const T *addend, std::size_t addendSize) {
+            T carry = 0;
+
+            std::size_t i = 0;
+            for (; i < addendSize; ++i) {
+                T sum = target[i] + addend[i];
+                T nextCarry = sum < addend[i];
+                target[i] = sum + carry;
+                carry = nextCarry | (target[i] < carry);
+            }
+
+            for (; carry && i < targetSize; ++i) {
+                ++target[i];
+                carry = target[i] == 0;
+            }
+
+            return carry;
+        }
+
+        // Subtracts range [subtrahend, subtrahend + subtrahendSize) from range [target, target + targetSize).
+        // Returns borrow.
+        template<class T>
+        T subtractFrom(T *target, std::size_t targetSize, const T *subtrahend, std::size_t subtrahendSize) {
+            T borrow = 0;
+
+            std::size_t i = 0;
+            for (; i < subtrahendSize; ++i) {
+                T difference = target[i] - subtrahend[i];
+                T nextBorrow = target[i] < subtrahend[i];
+                nextBorrow |= difference < borrow;
+                target[i] = difference - borrow;
+                borrow = nextBorrow;
+            }
+
+            for (; borrow && i < targetSize; ++i) {
+                borrow = target[i] == 0;
+                --target[i];
+            }
+
+            return borrow;
+        }
+
+        template<class T>
+        void add(std::vector<T> &target, const std::vector<T> &addend) {
+            if (target.size() < addend.size()) {
+                target.resize(addend.size(), 0);
+            }
+
+            if (addInto(target.data(), target.size(), addend.data(), addend.size())) {
+                target.push_back(1);
+            }
+        }
+
+        // Subtracts subtrahend from target, which must not be less than subtrahend.
+        template<class T>
+        void subtract(std::vector<T> &target, const std::vector<T> &subtrahend) {
+            subtractFrom(target.data(), target.size(), subtrahend.data(), subtrahend.size());
+            trim(target);
+        }
+
+        template<class T>
+        void shiftLeft(std::vector<T> &value, std::size_t count) {
+            if (value.empty()) {
+                return;
+            }
+
+            std::size_t pieceShift = count / pieceSize<T>();
+            std::size_t bitShift = count % pieceSize<T>();
+
+            if (bitShift > 0) {
+                T carry = 0;
+
+                for (T &piece: value) {
+                    T next = static_cast<T>(piece >> (pieceSize<T>() - bitShift));
+                    piece = static_cast<T>(piece << bitShift) | carry;
+                    carry = next;
+                }
+
+                if (carry) {
+                    value.push_back(carry);
+                }
+            }
+
+            value.insert(value.begin(), pieceShift, 0);
+        }
+
+        template<class T>
+        void shiftRight(std::vector<T> &value, std::size_t count) {
+            std::size_t pieceShift = count / pieceSize<T>();
+            std::size_t bitShift = count % pieceSize<T>();
+
+            if (pieceShift >= value.size()) {
+                value.clear();
+                return;
+            }
+
+            value.erase(value.begin(), value.begin() + static_cast<std::ptrdiff_t>(pieceShift));
+
+            if (bitShift > 0) {
+                for (std::size_t i = 0; i < value.size(); ++i) {
+                    T upper = i + 1 < value.size() ? static_cast<T>(value[i + 1] << (pieceSize<T>() - bitShift)) : 0;
+                    value[i] = static_cast<T>(value[i] >> bitShift) | upper;
+                }
+            }
+
+            trim(value);
+        }
+
+        // Keeps only given amount of lowest bits of value.
+        template<class T>
+        void truncate(std::vector<T> &value, std::size_t count) {
+            std::size_t pieceCount = count / pieceSize<T>();
+            std::size_t bitCount = count % pieceSize<T>();
+
+            if (pieceCount >= value.size()) {
+                return;
+            }
+
+            value.resize(pieceCount + (bitCount > 0 ? 1 : 0));
+
+            if (bitCount > 0) {
+                value.back() = static_cast<T>(value.back() & ((static_cast<T>(1) << bitCount) - 1));
+            }
+
+            trim(value);
+        }
+
+        // Value formed by bits [shift, shift + 64) of given value.
+        template<class T>
+        uint64_t extractBits(const std::vector<T> &value, std::size_t shift) {
+            std::size_t piece = shift / pieceSize<T>();
+
+            if (piece >= value.size()) {
+                return 0;
+            }
+
+            uint64_t result = static_cast<uint64_t>(value[piece]) >> (shift % pieceSize<T>());
+            std::size_t position = pieceSize<T>() - shift % pieceSize<T>();
+
+            for (++piece; position < 64 && piece < value.size(); ++piece) {
+                result |= static_cast<uint64_t>(value[piece]) << position;
+                position += pieceSize<T>();
+            }
+
+            return result;
+        }
+
+        // Writes product of two ranges to output, which must hold firstSize + secondSize pieces.
+        template<class T>
+        void schoolbookMultiply(const T *first, std::size_t firstSize, const T *second, std::size_t secondSize,
+                                T *output) {
+            using Wide = typename DoublePiece<T>::type;
+
+            std::fill(output, output + firstSize + secondSize, 0);
+
+            for (std::size_t i = 0; i < firstSize; ++i) {
+                if (first[i] == 0) {
+                    continue;
+                }
+
+                Wide carry = 0;
+                for (std::size_t j = 0; j < secondSize; ++j) {
+                    Wide current = static_cast<Wide>(first[i]) * second[j] + output[i + j] + carry;
+                    output[i + j] = static_cast<T>(current);
+                    carry = current >> pieceSize<T>();
+                }
+
+                output[i + secondSize] = static_cast<T>(carry);
+            }
+        }
+
+        // Checks whether products of operands of given size should be split into tasks of thread pool.
+        inline bool isParallelProduct(std::size_t size, bool isParallel) {
+            return isParallel && size >= getParallelMultiplicationThreshold() && getThreadCount() > 1;
+        }
+
+        // Records method, which top level of a product with shorter operand of given length uses.
+        inline void countProductMethod(std::size_t shorterSize, bool isParallel) {
+            if (shorterSize < KARATSUBA_THRESHOLD) {
+                BIG_NUMBERS_COUNT(SCHOOLBOOK_MULTIPLICATIONS, 1);
+            } else if (isParallelProduct(shorterSize, isParallel)) {
+                BIG_NUMBERS_COUNT(PARALLEL_MULTIPLICATIONS, 1);
+            } else {
+                BIG_NUMBERS_COUNT(KARATSUBA_MULTIPLICATIONS, 1);
+            }
+        }
+
+        // Writes product of two ranges to output, which must hold firstSize + secondSize pieces. Balanced operands
+        // are split in halves and multiplied by Karatsuba method, unbalanced are multiplied chunk by chunk. Large
+        // sub-products are computed by thread pool, unless parallelism is disabled.
+        template<class T>
+        void multiplyInto(const T *first, std::size_t firstSize, const T *second, std::size_t secondSize,
+                          T *output, bool isParallel = true) {
+            if (firstSize < secondSize) {
+                std::swap(first, second);
+                std::swap(firstSize, secondSize);
+            }
+
+            if (secondSize < KARATSUBA_THRESHOLD) {
+                schoolbookMultiply(first, firstSize, second, secondSize, output);
+                return;
+            }
+
+            bool isSplit = isParallelProduct(secondSize, isParallel);
+
+            if (firstSize >= 2 * secondSize) {
+                std::size_t chunkCount = (firstSize + secondSize - 1) / secondSize;
+                std::vector<std::vector<T>> chunkProducts(isSplit ? chunkCount : 1, std::vector<T>(2 * secondSize));
+#ifdef BIG_NUMBERS_STATS
+                for (const auto &chunkProduct: chunkProducts) {
+                    BIG_NUMBERS_COUNT_ALLOCATION(chunkProduct.size() * sizeof(T));
+                }
+#endif
+
+                auto multiplyChunk = [=, &chunkProducts](std::size_t chunk) {
+                    std::size_t offset = chunk * secondSize;
+                    std::size_t chunkSize = std::min(secondSize, firstSize - offset);
+                    multiplyInto(first + offset, chunkSize, second, secondSize,
+                                 chunkProducts[isSplit ? chunk : 0].data(), isParallel);
+                };
+
+                auto addChunk = [=, &chunkProducts](std::size_t chunk) {
+                    std::size_t offset = chunk * secondSize;
+                    std::size_t chunkSize = std::min(secondSize, firstSize - offset);
+                    addInto(output + offset, firstSize + secondSize - offset,
+                            chunkProducts[isSplit ? chunk : 0].data(), chunkSize + secondSize);
+                };
+
+                std::fill(output, output + firstSize + secondSize, 0);
+
+                if (isSplit) {
+                    ThreadPool::TaskGroup group;
+                    for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+                        group.run([&multiplyChunk, chunk]() {
+                            multiplyChunk(chunk);
+                        });
+                    }
+
+                    multiplyChunk(0);
+                    group.wait();
+
+                    for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                        addChunk(chunk);
+                    }
+                } else {
+                    for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                        multiplyChunk(chunk);
+                        addChunk(chunk);
+                    }
+                }
+
+                return;
+            }
+
+            std::size_t half = (firstSize + 1) / 2;
+            std::size_t firstHighSize = firstSize - half;
+            std::size_t secondHighSize = secondSize - half;
+
+            ThreadPool::TaskGroup group;
+
+            auto multiplyLow = [=]() {
+                multiplyInto(first, half, second, half, output, isParallel);
+            };
+
+            auto multiplyHigh = [=]() {
+                multiplyInto(first + half, firstHighSize, second + half, secondHighSize, output + 2 * half,
+                             isParallel);
+            };
+
+            if (isSplit) {
+                group.run(multiplyLow);
+                group.run(multiplyHigh);
+            }
+
+            std::vector<T> firstSum(first, first + half);
+            firstSum.push_back(addInto(firstSum.data(), half, first + half, firstHighSize));
+
+            std::vector<T> secondSum(second, second + half);
+            secondSum.push_back(addInto(secondSum.data(), half, second + half, secondHighSize));
+
+            std::vector<T> middle(2 * half + 2);
+            BIG_NUMBERS_COUNT_ALLOCATION(firstSum.capacity() * sizeof(T));
+            BIG_NUMBERS_COUNT_ALLOCATION(secondSum.capacity() * sizeof(T));
+            BIG_NUMBERS_COUNT_ALLOCATION(middle.size() * sizeof(T));
+
+            multiplyInto(firstSum.data(), firstSum.size(), secondSum.data(), secondSum.size(), middle.data(),
+                         isParallel);
+
+            if (isSplit) {
+                group.wait();
+            } else {
+                multiplyLow();
+                multiplyHigh();
+            }
+
+            subtractFrom(middle.data(), middle.size(), output, 2 * half);
+            subtractFrom(middle.data(), middle.size(), output + 2 * half, firstHighSize + secondHighSize);
+
+            std::size_t middleSize = middle.size();
+            while (middleSize > 0 && middle[middleSize - 1] == 0) {
+                --middleSize;
+            }
+
+            addInto(output + half, firstSize + secondSize - half, middle.data(), middleSize);
+        }
+
+        template<class T>
+        std::vector<T> multiply(const std::vector<T> &first, const std::vector<T> &second, bool isParallel = true) {
+            if (first.empty() || second.empty()) {
+                return {};
+            }
+
+            countProductMethod(std::min(first.size(), second.size()), isParallel);
+
+            std::vector<T> product(first.size() + second.size());
+            BIG_NUMBERS_COUNT_ALLOCATION(product.size() * sizeof(T));
+
+            multiplyInto(first.data(), first.size(), second.data(), second.size(), product.data(), isParallel);
+            trim(product);
+
+            return product;
+        }
+
+        // Writes to output, which must hold 2 * size pieces, product of two ranges of equal size without partial
+        // products below column size - 1. Result is less than exact product by less than size * base^size, lower
+        // pieces of output are left incomplete. Large ranges are split by Mulders' method: top 70% of operands are
+        // multiplied fully and the two cross products are short ones again.
+        template<class T>
+        void multiplyHighInto(const T *first, const T *second, std::size_t size, T *output, bool isParallel = true) {
+            using Wide = typename DoublePiece<T>::type;
+
+            std::fill(output, output + 2 * size, 0);
+
+            if (size < KARATSUBA_THRESHOLD) {
+                for (std::size_t i = 0; i < size; ++i) {
+                    Wide carry = 0;
+                    for (std::size_t j = size - 1 - i; j < size; ++j) {
+                        Wide current = static_cast<Wide>(first[i]) * second[j] + output[i + j] + carry;
+                        output[i + j] = static_cast<T>(current);
+                        carry = current >> pieceSize<T>();
+                    }
+
+                    output[i + size] = static_cast<T>(carry);
+                }
+
+                return;
+            }
+
+            std::size_t lowSize = size * 3 / 10;
+            std::size_t highSize = size - lowSize;
+
+            multiplyInto(first + lowSize, highSize, second + lowSize, highSize, output + 2 * lowSize, isParallel);
+
+            std::vector<T> cross(2 * lowSize);
+            BIG_NUMBERS_COUNT_ALLOCATION(cross.size() * sizeof(T));
+
+            multiplyHighInto(first, second + highSize, lowSize, cross.data(), isParallel);
+            addInto(output + highSize, 2 * size - highSize, cross.data(), cross.size());
+
+            multiplyHighInto(first + highSize, second, lowSize, cross.data(), isParallel);
+            addInto(output + highSize, 2 * size - highSize, cross.data(), cross.size());
+        }
+
+        // Pieces at the bottom of short product, which may differ from exact one: errors of truncated operands and
+        // omitted partial products reach up to log_base(size) + 2 pieces.
+        template<class T>
+        std::size_t getShortProductGuard(std::size_t size) {
+            std::size_t guard = 2;
+
+            for (std::size_t rest = size; pieceSize<T>() < 64 && (rest >>= pieceSize<T>()) > 0;) {
+                ++guard;
+            }
+
+            return guard;
+        }
+
+        // Top pieces of product, at least width of them and guard pieces below. Product is approximately result *
+        // base^dropped, it may be less than exact one in guard pieces. Lower pieces of operands, which do not reach
+        // the result, are ignored, and operands of similar length are multiplied by short product.
+        template<class T>
+        std::vector<T> multiplyHigh(const std::vector<T> &first, const std::vector<T> &second, std::size_t width,
+                                    std::size_t &dropped, bool isParallel = true) {
+            dropped = 0;
+
+            if (first.empty() || second.empty()) {
+                return {};
+            }
+
+            std::size_t guard = getShortProductGuard<T>(width);
+            std::size_t size = width + guard;
+
+            std::size_t firstSize = std::min(first.size(), size), secondSize = std::min(second.size(), size);
+            const T *firstTop = first.data() + first.size() - firstSize;
+            const T *secondTop = second.data() + second.size() - secondSize;
+
+            dropped = first.size() - firstSize + second.size() - secondSize;
+
+            std::vector<T> product;
+
+            // Short product needs operands of equal size, shorter ones are padded with a few zero pieces.
+            if (std::min(firstSize, secondSize) + guard >= size && size > 4 * guard) {
+                BIG_NUMBERS_COUNT(SHORT_MULTIPLICATIONS, 1);
+
+                std::vector<T> firstPadded(size - firstSize, 0), secondPadded(size - secondSize, 0);
+                firstPadded.insert(firstPadded.end(), firstTop, firstTop + firstSize);
+                secondPadded.insert(secondPadded.end(), secondTop, secondTop + secondSize);
+
+                product.resize(2 * size);
+                BIG_NUMBERS_COUNT_ALLOCATION(firstPadded.capacity() * sizeof(T));
+                BIG_NUMBERS_COUNT_ALLOCATION(secondPadded.capacity() * sizeof(T));
+                BIG_NUMBERS_COUNT_ALLOCATION(product.size() * sizeof(T));
+
+                multiplyHighInto(firstPadded.data(), secondPadded.data(), size, product.data(), isParallel);
+
+                // Padding shifted product up by (size - firstSize) + (size - secondSize) pieces.
+                product.erase(product.begin(), product.begin() + (size - 1));
+                dropped += (size - 1) - (size - firstSize) - (size - secondSize);
+            } else {
+                countProductMethod(secondSize, isParallel);
+
+                product.resize(firstSize + secondSize);
+                BIG_NUMBERS_COUNT_ALLOCATION(product.size() * sizeof(T));
+
+                multiplyInto(firstTop, firstSize, secondTop, secondSize, product.data(), isParallel);
+
+                // Ignored pieces of operands make lower pieces of product inexact, they are dropped as well.
+                if (dropped > 0 && product.size() > size + 1) {
+                    std::size_t inexact = product.size() - (size + 1);
+
+                    product.erase(product.begin(), product.begin() + inexact);
+                    dropped += inexact;
+                }
+            }
+
+            trim(product);
+
+            return product;
+        }
+
+        // Writes square of range to output, which must hold 2 * size pieces. Each cross product is computed once and
+        // doubled, so it needs about half of schoolbook multiplications.
+        template<class T>
+        void schoolbookSquare(const T *value, std::size_t size, T *output) {
+            using Wide = typename DoublePiece<T>::type;
+
+            std::fill(output, output + 2 * size, 0);
+
+            for (std::size_t i = 0; i < size; ++i) {
+                if (value[i] == 0) {
+                    continue;
+                }
+
+                Wide carry = 0;
+                for (std::size_t j = i + 1; j < size; ++j) {
+                    Wide current = static_cast<Wide>(value[i]) * value[j] + output[i + j] + carry;
+                    output[i + j] = static_cast<T>(current);
+                    carry = current >> pieceSize<T>();
+                }
+
+                output[i + size] = static_cast<T>(carry);
+            }
+
+            T shiftCarry = 0;
+            for (std::size_t i = 0; i < 2 * size; ++i) {
+                T next = static_cast<T>(output[i] >> (pieceSize<T>() - 1));
+                output[i] = static_cast<T>(output[i] << 1) | shiftCarry;
+                shiftCarry = next;
+            }
+
+            Wide carry = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                Wide current = static_cast<Wide>(value[i]) * value[i] + output[2 * i] + carry;
+                output[2 * i] = static_cast<T>(current);
+
+                current = (current >> pieceSize<T>()) + output[2 * i + 1];
+                output[2 * i + 1] = static_cast<T>(current);
+                carry = current >> pieceSize<T>();
+            }
+        }
+
+        // Writes square of range to output, which must hold 2 * size pieces. Karatsuba squaring needs three squares
+        // of halves instead of general products.
+        template<class T>
+        void squareInto(const T *value, std::size_t size, T *output, bool isParallel = true) {
+            if (size < KARATSUBA_THRESHOLD) {
+                schoolbookSquare(value, size, output);
+                return;
+            }
+
+            std::size_t half = (size + 1) / 2;
+            std::size_t highSize = size - half;
+
+            bool isSplit = isParallelProduct(size, isParallel);
+            ThreadPool::TaskGroup group;
+
+            auto squareLow = [=]() {
+                squareInto(value, half, output, isParallel);
+            };
+
+            auto squareHigh = [=]() {
+                squareInto(value + half, highSize, output + 2 * half, isParallel);
+            };
+
+            if (isSplit) {
+                group.run(squareLow);
+                group.run(squareHigh);
+            }
+
+            std::vector<T> sum(value, value + half);
+            sum.push_back(addInto(sum.data(), half, value + half, highSize));
+
+            std::vector<T> middle(2 * half + 2);
+            BIG_NUMBERS_COUNT_ALLOCATION(sum.capacity() * sizeof(T));
+            BIG_NUMBERS_COUNT_ALLOCATION(middle.size() * sizeof(T));
+
+            squareInto(sum.data(), sum.size(), middle.data(), isParallel);
+
+            if (isSplit) {
+                group.wait();
+            } else {
+                squareLow();
+                squareHigh();
+            }
+
+            subtractFrom(middle.data(), middle.size(), output, 2 * half);
+            subtractFrom(middle.data(), middle.size(), output + 2 * half, 2 * highSize);
+
+            std::size_t middleSize = middle.size();
+            while (middleSize > 0 && middle[middleSize - 1] == 0) {
+                --middleSize;
+            }
+
+            addInto(output + half, 2 * size - half, middle.data(), middleSize);
+        }
+
+        template<class T>
+        std::vector<T> square(const std::vector<T> &value, bool isParallel = true) {
+            if (value.empty()) {
+                return {};
+            }
+
+            countProductMethod(value.size(), isParallel);
+
+            std::vector<T> product(2 * value.size());
+            BIG_NUMBERS_COUNT_ALLOCATION(product.size() * sizeof(T));
+
+            squareInto(value.data(), value.size(), product.data(), isParallel);
+            trim(product);
+
+            return product;
+        }
+
+        // Divides value by single piece in place. Returns remainder.
+        template<class T>
+        T divideByPiece(std::vector<T> &value, T divisor) {
+            using Wide = typename DoublePiece<T>::type;
+
+            Wide remainder = 0;
+
+            for (std::size_t i = value.size(); i > 0; --i) {
+                Wide current = (remainder << pieceSize<T>()) | value[i - 1];
+                value[i - 1] = static_cast<T>(current / divisor);
+                remainder = current % divisor;
+            }
+
+            trim(value);
+
+            return static_cast<T>(remainder);
+        }
+
+        // Core of Knuth's algorithm D. Divisor must have its top bit set and current must have at least one piece
+        // more than divisor, with top piece small enough for quotient to fit into currentSize - divisorSize pieces.
+        // Quotient is written to given range, remainder replaces lower divisorSize pieces of current.
+        template<class T>
+        void divideNormalized(T *current, std::size_t currentSize, const T *divisor, std::size_t divisorSize,
+                              T *quotient) {
+            using Wide = typename DoublePiece<T>::type;
+
+            constexpr std::size_t BITS = pieceSize<T>();
+            const Wide base = static_cast<Wide>(1) << BITS;
+
+            T divisorTop = divisor[divisorSize - 1];
+            T divisorNext = divisor[divisorSize - 2];
+
+            for (std::size_t j = currentSize - divisorSize; j > 0; --j) {
+                std::size_t position = j - 1;
+
+                Wide numerator = (static_cast<Wide>(current[position + divisorSize]) << BITS) |
+                                 current[position + divisorSize - 1];
+                Wide estimate = numerator / divisorTop;
+                Wide estimateRemainder = numerator % divisorTop;
+
+                while (estimate >= base || estimate * divisorNext >
+                                           ((estimateRemainder << BITS) | current[position + divisorSize - 2])) {
+                    --estimate;
+                    estimateRemainder += divisorTop;
+
+                    if (estimateRemainder >= base) {
+                        break;
+                    }
+                }
+
+                Wide carry = 0;
+                T borrow = 0;
+                for (std::size_t i = 0; i < divisorSize; ++i) {
+                    Wide product = estimate * divisor[i] + carry;
+                    carry = product >> BITS;
+
+                    T low = static_cast<T>(product);
+                    T &target = current[position + i];
+                    T difference = target - low;
+                    T nextBorrow = target < low;
+                    nextBorrow |= difference < borrow;
+                    target = difference - borrow;
+                    borrow = nextBorrow;
+                }
+
+                T &top = current[position + divisorSize];
+                Wide total = carry + borrow;
+                bool isNegative = static_cast<Wide>(top) < total;
+                top = static_cast<T>(top - static_cast<T>(total));
+
+                if (isNegative) {
+                    --estimate;
+                    T addCarry = addInto(current + position, divisorSize, divisor, divisorSize);
+                    top = static_cast<T>(top + addCarry);
+                }
+
+                quotient[position] = static_cast<T>(estimate);
+            }
+        }
+
+        // Long division (Knuth's algorithm D). Dividend is replaced by quotient, remainder is written to given
+        // argument.
+        template<class T>
+        void divide(std::vector<T> &dividend, const std::vector<T> &divisor, std::vector<T> &remainder) {
+            constexpr std::size_t BITS = pieceSize<T>();
+
+            if (divisor.empty()) {
+                throw std::logic_error("Cannot divide by zero.");
+            }
+
+            if (compare(dividend, divisor) < 0) {
+                remainder = dividend;
+                dividend.clear();
+                return;
+            }
+
+            if (divisor.size() == 1) {
+                BIG_NUMBERS_COUNT(PIECE_DIVISIONS, 1);
+                remainder = {divideByPiece(dividend, divisor.front())};
+                trim(remainder);
+                return;
+            }
+
+            BIG_NUMBERS_COUNT(LONG_DIVISIONS, 1);
+
+            std::size_t normalization = 0;
+            for (T top = divisor.back(); (top & (static_cast<T>(1) << (BITS - 1))) == 0; top <<= 1) {
+                ++normalization;
+            }
+
+            std::vector<T> normalizedDivisor = divisor;
+            shiftLeft(normalizedDivisor, normalization);
+
+            std::vector<T> current = dividend;
+            shiftLeft(current, normalization);
+            current.resize(dividend.size() + 1, 0);
+
+            std::size_t divisorSize = normalizedDivisor.size();
+            std::vector<T> quotient(current.size() - divisorSize, 0);
+            BIG_NUMBERS_COUNT_ALLOCATION(normalizedDivisor.capacity() * sizeof(T));
+            BIG_NUMBERS_COUNT_ALLOCATION(current.capacity() * sizeof(T));
+            BIG_NUMBERS_COUNT_ALLOCATION(quotient.size() * sizeof(T));
+
+            divideNormalized(current.data(), current.size(), normalizedDivisor.data(), divisorSize, quotient.data());
+
+            current.resize(divisorSize);
+            trim(current);
+            shiftRight(current, normalization);
+
+            trim(quotient);
+            dividend = quotient;
+            remainder = current;
+        }
+    }
+}
+
+#endif //BIG_NUMBERS_MAGNITUDEUTILS_H
@@ -0,0 +1,953 @@
+#include "NumberTheoryUtils.h"
+
+#include "MagnitudeUtils.h"
+#include "Stats.h"
+#include "config.h"
+
+#include <cmath>
+
+namespace BigNumbers {
+    // Values up to this amount of bits are handled by binary gcd.
+    constexpr std::size_t BINARY_GCD_LIMIT = 256;
+
+    // Values of this amount of bits and more are reduced by half-gcd before switching to Lehmer's algorithm.
+    constexpr std::size_t HALF_GCD_THRESHOLD = 8192;
+
+    // Half-gcd of values shorter than this amount of bits is computed directly, without recursion.
+    constexpr std::size_t HALF_GCD_RECURSION_THRESHOLD = 2048;
+
+    // Width of leading parts, which are reduced by single-precision steps of Lehmer's algorithm.
+    constexpr std::size_t LEHMER_DIGIT_WIDTH = 62;
+
+    // Square roots of values up to this amount of bits are computed in machine words.
+    constexpr std::size_t SQRT_WORD_LIMIT = 62;
+
+    template<class T>
+    std::vector<T> toMagnitude(BigIntBackend<T> value) {
+        if (value.getSign()) {
+            value.negate();
+        }
+
+        std::vector<T> magnitude = value.accessPieces();
+        Magnitude::trim(magnitude);
+
+        return magnitude;
+    }
+
+    template<class T>
+    BigIntBackend<T> fromMagnitude(const std::vector<T> &magnitude, bool isNegative) {
+        BigIntBackend<T> value(false, magnitude);
+
+        if (isNegative && !magnitude.empty()) {
+            value.negate();
+        }
+
+        return value;
+    }
+
+    // Unimodular matrix with non-negative entries, which relates original pair of values to the current one:
+    // (original first, original second) = matrix * (current first, current second).
+    template<class T>
+    struct CofactorMatrix {
+        std::vector<T> entries[2][2];
+        bool isDeterminantNegative;
+
+        CofactorMatrix() : isDeterminantNegative(false) {
+            entries[0][0] = {1};
+            entries[1][1] = {1};
+        }
+
+        bool isIdentity() const {
+            return entries[0][1].empty() && entries[1][0].empty() && !isDeterminantNegative &&
+                   entries[0][0] == std::vector<T>{1} && entries[1][1] == std::vector<T>{1};
+        }
+
+        // Multiplies this matrix by given one from the right.
+        void multiply(const CofactorMatrix<T> &other) {
+            std::vector<T> result[2][2];
+
+            for (std::size_t row = 0; row < 2; ++row) {
+                for (std::size_t column = 0; column < 2; ++column) {
+                    result[row][column] = Magnitude::multiply(entries[row][0], other.entries[0][column]);
+                    Magnitude::add(result[row][column],
+                                   Magnitude::multiply(entries[row][1], other.entries[1][column]));
+                }
+            }
+
+            for (std::size_t row = 0; row < 2; ++row) {
+                for (std::size_t column = 0; column < 2; ++column) {
+                    entries[row][column].swap(result[row][column]);
+                }
+            }
+
+            isDeterminantNegative ^= other.isDeterminantNegative;
+        }
+
+        // Multiplies this matrix by ((1, quotient), (0, 1)) from the right, which corresponds to subtracting
+        // quotient * second from first.
+        void addColumnMultiple(const std::vector<T> &quotient) {
+            for (std::size_t row = 0; row < 2; ++row) {
+                Magnitude::add(entries[row][1], Magnitude::multiply(entries[row][0], quotient));
+            }
+        }
+
+        // Multiplies this matrix by ((0, 1), (1, 0)) from the right, which corresponds to swapping current pair.
+        void swapColumns() {
+            for (std::size_t row = 0; row < 2; ++row) {
+                entries[row][0].swap(entries[row][1]);
+            }
+
+            isDeterminantNegative = !isDeterminantNegative;
+        }
+
+        // Multiplies this matrix by ((quotient, 1), (1, 0)) from the right, which corresponds to single Euclid step.
+        void applyQuotient(const std::vector<T> &quotient) {
+            addColumnMultiple(quotient);
+            swapColumns();
+        }
+    };
+
+    template<class T>
+    std::vector<T> binaryGcd(std::vector<T> first, std::vector<T> second) {
+        if (first.empty()) {
+            return second;
+        }
+
+        if (second.empty()) {
+            return first;
+        }
+
+        std::size_t firstZeros = Magnitude::countTrailingZeros(first);
+        std::size_t secondZeros = Magnitude::countTrailingZeros(second);
+
+        Magnitude::shiftRight(first, firstZeros);
+        Magnitude::shiftRight(second, secondZeros);
+
+        for (;;) {
+            int comparison = Magnitude::compare(first, second);
+
+            if (comparison == 0) {
+                break;
+            }
+
+            if (comparison < 0) {
+                first.swap(second);
+            }
+
+            Magnitude::subtract(first, second);
+            Magnitude::shiftRight(first, Magnitude::countTrailingZeros(first));
+        }
+
+        Magnitude::shiftLeft(first, std::min(firstZeros, secondZeros));
+
+        return first;
+    }
+
+    // Replaces pair (first, second) by (second, first mod second).
+    template<class T>
+    void euclidStep(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> *matrix) {
+        std::vector<T> remainder;
+        Magnitude::divide(first, second, remainder);
+
+        if (matrix != nullptr) {
+            matrix->applyQuotient(first);
+        }
+
+        first.swap(second);
+        second.swap(remainder);
+    }
+
+    // Computes |positiveCoefficient| * positive - |negativeCoefficient| * negative. Returns false if the result is
+    // negative.
+    template<class T>
+    bool combine(const std::vector<T> &positive, int64_t positiveCoefficient, const std::vector<T> &negative,
+                 int64_t negativeCoefficient, std::vector<T> &result) {
+        result = Magnitude::multiply(positive, Magnitude::fromUint64<T>(
+                static_cast<uint64_t>(positiveCoefficient < 0 ? -positiveCoefficient : positiveCoefficient)));
+        std::vector<T> subtrahend = Magnitude::multiply(negative, Magnitude::fromUint64<T>(
+                static_cast<uint64_t>(negativeCoefficient < 0 ? -negativeCoefficient : negativeCoefficient)));
+
+        if (Magnitude::compare(result, subtrahend) < 0) {
+            return false;
+        }
+
+        Magnitude::subtract(result, subtrahend);
+
+        return true;
+    }
+
+    // Performs several Euclid steps on pair first >= second at once, simulating them on leading bits of both values
+    // (Knuth's algorithm L with Collins' condition). Steps are rejected if new second value would fall below given
+    // floor. Returns false if no step was done, so the caller must do a full one.
+    template<class T>
+    bool lehmerStep(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> *matrix,
+                    const std::vector<T> &floor) {
+        std::size_t length = Magnitude::bitLength(first);
+        std::size_t shift = length > LEHMER_DIGIT_WIDTH ? length - LEHMER_DIGIT_WIDTH : 0;
+
+        auto x = static_cast<int64_t>(Magnitude::extractBits(first, shift));
+        auto y = static_cast<int64_t>(Magnitude::extractBits(second, shift));
+
+        int64_t a = 1, b = 0, c = 0, d = 1;
+        std::size_t steps = 0;
+
+        while (y + c != 0 && y + d != 0) {
+            int64_t quotient = (x + a) / (y + c);
+
+            if (quotient != (x + b) / (y + d)) {
+                break;
+            }
+
+            int64_t temporary = a - quotient * c;
+            a = c;
+            c = temporary;
+
+            temporary = b - quotient * d;
+            b = d;
+            d = temporary;
+
+            temporary = x - quotient * y;
+            x = y;
+            y = temporary;
+
+            ++steps;
+        }
+
+        if (b == 0) {
+            return false;
+        }
+
+        // Coefficients in each row have opposite signs.
+        std::vector<T> nextFirst, nextSecond;
+        bool isValid = a >= 0 ? combine(first, a, second, b, nextFirst) : combine(second, b, first, a, nextFirst);
+        isValid = isValid && (c >= 0 ? combine(first, c, second, d, nextSecond) :
+                              combine(second, d, first, c, nextSecond));
+
+        if (!isValid || Magnitude::compare(nextSecond, floor) < 0) {
+            return false;
+        }
+
+        if (matrix != nullptr) {
+            CofactorMatrix<T> step;
+            step.entries[0][0] = Magnitude::fromUint64<T>(static_cast<uint64_t>(d < 0 ? -d : d));
+            step.entries[0][1] = Magnitude::fromUint64<T>(static_cast<uint64_t>(b < 0 ? -b : b));
+            step.entries[1][0] = Magnitude::fromUint64<T>(static_cast<uint64_t>(c < 0 ? -c : c));
+            step.entries[1][1] = Magnitude::fromUint64<T>(static_cast<uint64_t>(a < 0 ? -a : a));
+            step.isDeterminantNegative = steps % 2 == 1;
+
+            matrix->multiply(step);
+        }
+
+        first.swap(nextFirst);
+        second.swap(nextSecond);
+
+        return true;
+    }
+
+    // Replaces pair (first, second) by inverse of matrix applied to it, keeping first >= second. Pair is left
+    // untouched and false is returned if any of the results is negative.
+    template<class T>
+    bool applyInverse(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> &matrix) {
+        const auto &m = matrix.entries;
+
+        std::vector<T> firstPositive = Magnitude::multiply(m[1][1], first);
+        std::vector<T> firstNegative = Magnitude::multiply(m[0][1], second);
+        std::vector<T> secondPositive = Magnitude::multiply(m[0][0], second);
+        std::vector<T> secondNegative = Magnitude::multiply(m[1][0], first);
+
+        if (matrix.isDeterminantNegative) {
+            firstPositive.swap(firstNegative);
+            secondPositive.swap(secondNegative);
+        }
+
+        if (Magnitude::compare(firstPositive, firstNegative) < 0 ||
+            Magnitude::compare(secondPositive, secondNegative) < 0) {
+            return false;
+        }
+
+        Magnitude::subtract(firstPositive, firstNegative);
+        Magnitude::subtract(secondPositive, secondNegative);
+
+        first.swap(firstPositive);
+        second.swap(secondPositive);
+
+        if (Magnitude::compare(first, second) < 0) {
+            first.swap(second);
+            matrix.swapColumns();
+        }
+
+        return true;
+    }
+
+    // Checks whether pair first >= second >= floor can not be reduced any further without second falling below
+    // floor.
+    template<class T>
+    bool isReduced(const std::vector<T> &first, const std::vector<T> &second, const std::vector<T> &floor) {
+        std::vector<T> difference = first;
+        Magnitude::subtract(difference, second);
+
+        return Magnitude::compare(difference, floor) < 0;
+    }
+
+    // Reduces pair first >= second >= floor by Lehmer steps and by division steps, which keep remainders not smaller
+    // than floor.
+    template<class T>
+    void reduceAboveFloor(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> &matrix,
+                          const std::vector<T> &floor) {
+        while (!isReduced(first, second, floor)) {
+            if (lehmerStep(first, second, &matrix, floor)) {
+                continue;
+            }
+
+            std::vector<T> remainder;
+            Magnitude::subtract(first, floor);
+            Magnitude::divide(first, second, remainder);
+            Magnitude::add(remainder, floor);
+
+            matrix.addColumnMultiple(first);
+            first.swap(remainder);
+
+            if (Magnitude::compare(first, second) < 0) {
+                first.swap(second);
+                matrix.swapColumns();
+            }
+        }
+    }
+
+    // Reduces pair first >= second until both values are not smaller than 2^s and their difference is less than
+    // 2^s, where s is a bit more than half of the bit length of first (Moller's half-gcd). Matrix relating original
+    // pair to the reduced one is written to the last argument. Leading halves are reduced recursively, so the cost
+    // is dominated by multiplications of matrices instead of quadratic amount of steps.
+    template<class T>
+    void halfGcd(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> &matrix) {
+        std::size_t length = Magnitude::bitLength(first);
+        std::size_t target = length / 2 + 1;
+
+        matrix = CofactorMatrix<T>();
+
+        if (Magnitude::bitLength(second) <= target) {
+            return;
+        }
+
+        std::vector<T> floor{1};
+        Magnitude::shiftLeft(floor, target);
+
+        if (length >= HALF_GCD_RECURSION_THRESHOLD) {
+            std::size_t split = length / 2;
+
+            std::vector<T> firstHigh = first, secondHigh = second;
+            Magnitude::shiftRight(firstHigh, split);
+            Magnitude::shiftRight(secondHigh, split);
+
+            CofactorMatrix<T> highMatrix;
+            halfGcd(firstHigh, secondHigh, highMatrix);
+
+            if (!highMatrix.isIdentity() && applyInverse(first, second, highMatrix)) {
+                matrix = highMatrix;
+            }
+
+            if (Magnitude::compare(second, floor) < 0 || isReduced(first, second, floor)) {
+                return;
+            }
+
+            lehmerStep(first, second, &matrix, floor);
+
+            std::size_t reducedLength = Magnitude::bitLength(first);
+            split = 2 * target + 1 > reducedLength ? 2 * target + 1 - reducedLength : 0;
+
+            if (Magnitude::compare(second, floor) >= 0 && !isReduced(first, second, floor) &&
+                reducedLength > split + 2) {
+                firstHigh = first;
+                secondHigh = second;
+                Magnitude::shiftRight(firstHigh, split);
+                Magnitude::shiftRight(secondHigh, split);
+
+                halfGcd(firstHigh, secondHigh, highMatrix);
+
+                std::vector<T> firstCopy = first, secondCopy = second;
+                if (!highMatrix.isIdentity() && applyInverse(firstCopy, secondCopy, highMatrix) &&
+                    Magnitude::compare(secondCopy, floor) >= 0) {
+                    first.swap(firstCopy);
+                    second.swap(secondCopy);
+                    matrix.multiply(highMatrix);
+                }
+            }
+        }
+
+        if (Magnitude::compare(second, floor) >= 0) {
+            reduceAboveFloor(first, second, matrix, floor);
+        }
+    }
+
+    // Reduces pair first >= second to (gcd, 0), updating matrix if it is given.
+    template<class T>
+    void reduce(std::vector<T> &first, std::vector<T> &second, CofactorMatrix<T> *matrix) {
+        const std::vector<T> zero;
+
+        while (Magnitude::bitLength(second) >= HALF_GCD_THRESHOLD) {
+            CofactorMatrix<T> step;
+            halfGcd(first, second, step);
+
+            if (step.isIdentity()) {
+                euclidStep(first, second, matrix);
+            } else if (matrix != nullptr) {
+                matrix->multiply(step);
+            }
+        }
+
+        while (!second.empty()) {
+            if (!lehmerStep(first, second, matrix, zero)) {
+                euclidStep(first, second, matrix);
+            }
+        }
+    }
+
+    template<class T>
+    BigIntBackend<T> gcd(const BigIntBackend<T> &first, const BigIntBackend<T> &second) {
+        std::vector<T> firstMagnitude = toMagnitude(first);
+        std::vector<T> secondMagnitude = toMagnitude(second);
+
+        if (Magnitude::compare(firstMagnitude, secondMagnitude) < 0) {
+            firstMagnitude.swap(secondMagnitude);
+        }
+
+        if (Magnitude::bitLength(firstMagnitude) <= BINARY_GCD_LIMIT) {
+            return fromMagnitude(binaryGcd(firstMagnitude, secondMagnitude), false);
+        }
+
+        reduce(firstMagnitude, secondMagnitude, static_cast<CofactorMatrix<T> *>(nullptr));
+
+        return fromMagnitude(firstMagnitude, false);
+    }
+
+    template<class T>
+    BigIntBackend<T> lcm(const BigIntBackend<T> &first, const BigIntBackend<T> &second) {
+        std::vector<T> firstMagnitude = toMagnitude(first);
+        std::vector<T> secondMagnitude = toMagnitude(second);
+
+        if (firstMagnitude.empty() || secondMagnitude.empty()) {
+            return BigIntBackend<T>();
+        }
+
+        std::vector<T> divisor = toMagnitude(gcd(first, second));
+        std::vector<T> remainder;
+        Magnitude::divide(firstMagnitude, divisor, remainder);
+
+        return fromMagnitude(Magnitude::multiply(firstMagnitude, secondMagnitude), false);
+    }
+
+    template<class T>
+    BigIntBackend<T> gcdext(const BigIntBackend<T> &first, const BigIntBackend<T> &second,
+                            BigIntBackend<T> &firstCoefficient, BigIntBackend<T> &secondCoefficient) {
+        std::vector<T> firstMagnitude = toMagnitude(first);
+        std::vector<T> secondMagnitude = toMagnitude(second);
+
+        bool isSwapped = Magnitude::compare(firstMagnitude, secondMagnitude) < 0;
+        if (isSwapped) {
+            firstMagnitude.swap(secondMagnitude);
+        }
+
+        CofactorMatrix<T> matrix;
+        reduce(firstMagnitude, secondMagnitude, &matrix);
+
+        // gcd = det * (m11 * first - m01 * second)
+        bool isFirstNegative = matrix.isDeterminantNegative;
+        bool isSecondNegative = !matrix.isDeterminantNegative;
+
+        if (isSwapped) {
+            std::swap(isFirstNegative, isSecondNegative);
+            matrix.entries[1][1].swap(matrix.entries[0][1]);
+        }
+
+        firstCoefficient = fromMagnitude(matrix.entries[1][1], isFirstNegative != static_cast<bool>(first.getSign()));
+        secondCoefficient = fromMagnitude(matrix.entries[0][1],
+                                          isSecondNegative != static_cast<bool>(second.getSign()));
+
+        return fromMagnitude(firstMagnitude, false);
+    }
+
+    // Inverse of value modulo positive modulus, both given as magnitudes.
+    template<class T>
+    std::vector<T> modInverseMagnitude(std::vector<T> value, const std::vector<T> &modulus, bool isValueNegative) {
+        std::vector<T> remainder;
+        Magnitude::divide(value, modulus, remainder);
+
+        std::vector<T> first = modulus;
+        std::vector<T> second = remainder;
+
+        CofactorMatrix<T> matrix;
+        reduce(first, second, &matrix);
+
+        if (first != std::vector<T>{1}) {
+            throw std::logic_error("Value is not invertible modulo given modulus.");
+        }
+
+        // 1 = det * (m11 * modulus - m01 * remainder), so inverse of remainder is det * m01 modulo modulus.
+        std::vector<T> inverse = matrix.entries[0][1];
+        std::vector<T> unused;
+        Magnitude::divide(inverse, modulus, unused);
+        inverse.swap(unused);
+
+        if (isValueNegative == matrix.isDeterminantNegative && !inverse.empty()) {
+            std::vector<T> complement = modulus;
+            Magnitude::subtract(complement, inverse);
+            inverse.swap(complement);
+        }
+
+        return inverse;
+    }
+
+    template<class T>
+    BigIntBackend<T> modInverse(const BigIntBackend<T> &value, const BigIntBackend<T> &modulus) {
+        std::vector<T> modulusMagnitude = toMagnitude(modulus);
+
+        if (modulus.getSign() || modulusMagnitude.empty()) {
+            throw std::logic_error("Modulus must be positive.");
+        }
+
+        return fromMagnitude(modInverseMagnitude(toMagnitude(value), modulusMagnitude,
+                                                 static_cast<bool>(value.getSign())), false);
+    }
+
+    template<class T>
+    BigIntBackend<T> chineseRemainder(const std::vector<BigIntBackend<T>> &residues,
+                                      const std::vector<BigIntBackend<T>> &moduli) {
+        if (residues.size() != moduli.size()) {
+            throw std::logic_error("Each residue must have its modulus.");
+        }
+
+        std::size_t count = moduli.size();
+        if (count == 0) {
+            return BigIntBackend<T>();
+        }
+
+        // Product tree: level 0 holds moduli, each next level holds products of pairs from the previous one.
+        std::vector<std::vector<std::vector<T>>> tree(1);
+        for (const auto &modulus: moduli) {
+            if (modulus.getSign() || toMagnitude(modulus).empty()) {
+                throw std::logic_error("Modulus must be positive.");
+            }
+
+            tree[0].push_back(toMagnitude(modulus));
+        }
+
+        while (tree.back().size() > 1) {
+            const auto &level = tree.back();
+            std::vector<std::vector<T>> next;
+
+            for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(Magnitude::multiply(level[i], level[i + 1]));
+            }
+
+            if (level.size() % 2 == 1) {
+                next.push_back(level.back());
+            }
+
+            tree.push_back(next);
+        }
+
+        // Remainder tree: product of all moduli is reduced modulo squares of nodes down to the leaves, where
+        // (product mod modulus^2) / modulus = (product / modulus) mod modulus.
+        std::vector<std::vector<T>> remainders{tree.back().front()};
+        for (std::size_t level = tree.size() - 1; level > 0; --level) {
+            std::vector<std::vector<T>> next;
+
+            for (std::size_t i = 0; i < tree[level - 1].size(); ++i) {
+                std::vector<T> value = remainders[i / 2];
+                std::vector<T> remainder;
+                Magnitude::divide(value, Magnitude::multiply(tree[level - 1][i], tree[level - 1][i]), remainder);
+                next.push_back(remainder);
+            }
+
+            remainders.swap(next);
+        }
+
+        // Leaves get coefficients residue * (product / modulus)^-1 mod modulus, which are combined back up the tree:
+        // value of node is left value * right product + right value * left product.
+        std::vector<std::vector<T>> values;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::vector<T> &modulus = tree[0][i];
+
+            std::vector<T> cofactor = remainders[i];
+            std::vector<T> unused;
+            Magnitude::divide(cofactor, modulus, unused);
+
+            std::vector<T> residue = toMagnitude(residues[i]);
+            Magnitude::divide(residue, modulus, unused);
+            residue.swap(unused);
+
+            if (residues[i].getSign() && !residue.empty()) {
+                std::vector<T> complement = modulus;
+                Magnitude::subtract(complement, residue);
+                residue.swap(complement);
+            }
+
+            std::vector<T> value = Magnitude::multiply(residue, modInverseMagnitude(cofactor, modulus, false));
+            Magnitude::divide(value, modulus, unused);
+            values.push_back(unused);
+        }
+
+        for (std::size_t level = 0; level + 1 < tree.size(); ++level) {
+            std::vector<std::vector<T>> next;
+
+            for (std::size_t i = 0; i + 1 < values.size(); i += 2) {
+                std::vector<T> value = Magnitude::multiply(values[i], tree[level][i + 1]);
+                Magnitude::add(value, Magnitude::multiply(values[i + 1], tree[level][i]));
+                next.push_back(value);
+            }
+
+            if (values.size() % 2 == 1) {
+                next.push_back(values.back());
+            }
+
+            values.swap(next);
+        }
+
+        std::vector<T> result = values.front();
+        std::vector<T> remainder;
+        Magnitude::divide(result, tree.back().front(), remainder);
+
+        return fromMagnitude(remainder, false);
+    }
+
+    // Floor of square root of 64-bit value.
+    inline uint64_t sqrt64(uint64_t value) {
+        auto root = static_cast<uint64_t>(std::sqrt(static_cast<double>(value)));
+
+        while (root > 0 && root > value / root) {
+            --root;
+        }
+
+        while (root + 1 <= value / (root + 1)) {
+            ++root;
+        }
+
+        return root;
+    }
+
+    // Karatsuba square root (Zimmermann's algorithm): splits value into four quarters, takes square root with
+    // remainder of the upper half recursively and corrects it by single division for the lower half.
+    template<class T>
+    std::vector<T> sqrtremMagnitude(const std::vector<T> &value, std::vector<T> &remainder) {
+        std::size_t length = Magnitude::bitLength(value);
+
+        if (length <= SQRT_WORD_LIMIT) {
+            uint64_t word = Magnitude::toUint64(value);
+            uint64_t root = sqrt64(word);
+
+            remainder = Magnitude::fromUint64<T>(word - root * root);
+
+            return Magnitude::fromUint64<T>(root);
+        }
+
+        // Shift by even amount, so that upper quarter is at least a quarter of its range.
+        std::size_t quarter = (length + 3) / 4;
+        std::size_t normalization = (4 * quarter - length) / 2;
+
+        std::vector<T> normalized = value;
+        Magnitude::shiftLeft(normalized, 2 * normalization);
+
+        std::vector<T> upper = normalized;
+        Magnitude::shiftRight(upper, 2 * quarter);
+
+        std::vector<T> lowest = normalized;
+        Magnitude::truncate(lowest, 2 * quarter);
+
+        std::vector<T> lower = lowest;
+        Magnitude::shiftRight(lower, quarter);
+        Magnitude::truncate(lowest, quarter);
+
+        std::vector<T> upperRemainder;
+        std::vector<T> root = sqrtremMagnitude(upper, upperRemainder);
+
+        // (quotient, rest) = divmod(upper remainder * 2^quarter + lower, 2 * upper root)
+        std::vector<T> quotient = upperRemainder;
+        Magnitude::shiftLeft(quotient, quarter);
+        Magnitude::add(quotient, lower);
+
+        std::vector<T> doubledRoot = root;
+        Magnitude::shiftLeft(doubledRoot, 1);
+
+        std::vector<T> rest;
+        Magnitude::divide(quotient, doubledRoot, rest);
+
+        Magnitude::shiftLeft(root, quarter);
+        Magnitude::add(root, quotient);
+
+        // remainder = rest * 2^quarter + lowest - quotient^2, root is decremented while it is negative.
+        remainder = rest;
+        Magnitude::shiftLeft(remainder, quarter);
+        Magnitude::add(remainder, lowest);
+
+        std::vector<T> square = Magnitude::multiply(quotient, quotient);
+
+        while (Magnitude::compare(remainder, square) < 0) {
+            Magnitude::add(remainder, root);
+            Magnitude::add(remainder, root);
+            Magnitude::subtract(remainder, std::vector<T>{1});
+            Magnitude::subtract(root, std::vector<T>{1});
+        }
+
+        Magnitude::subtract(remainder, square);
+
+        if (normalization > 0) {
+            Magnitude::shiftRight(root, normalization);
+
+            remainder = value;
+            Magnitude::subtract(remainder, Magnitude::multiply(root, root));
+        }
+
+        return root;
+    }
+
+    template<class T>
+    std::vector<T> powerMagnitude(const std::vector<T> &base, std::size_t exponent) {
+        std::vector<T> result{1};
+        std::vector<T> square = base;
+
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) {
+                result = Magnitude::multiply(result, square);
+            }
+
+            if (exponent > 1) {
+                square = Magnitude::multiply(square, square);
+            }
+        }
+
+        return result;
+    }
+
+    // Newton iteration for floor of degree-th root, started from power of two above the root.
+    template<class T>
+    std::vector<T> rootremMagnitude(const std::vector<T> &value, std::size_t degree, std::vector<T> &remainder) {
+        if (degree == 2) {
+            return sqrtremMagnitude(value, remainder);
+        }
+
+        std::size_t length = Magnitude::bitLength(value);
+
+        if (length == 0 || degree == 1) {
+            remainder.clear();
+            return value;
+        }
+
+        std::vector<T> root{1};
+        Magnitude::shiftLeft(root, (length + degree - 1) / degree);
+
+        const std::vector<T> degreeValue = Magnitude::fromUint64<T>(degree);
+        const std::vector<T> previousDegree = Magnitude::fromUint64<T>(degree - 1);
+
+        for (;;) {
+            BIG_NUMBERS_COUNT(NEWTON_ITERATIONS, 1);
+
+            // next = ((degree - 1) * root + value / root^(degree - 1)) / degree
+            std::vector<T> next = value;
+            std::vector<T> unused;
+            Magnitude::divide(next, powerMagnitude(root, degree - 1), unused);
+            Magnitude::add(next, Magnitude::multiply(root, previousDegree));
+            Magnitude::divide(next, degreeValue, unused);
+
+            if (Magnitude::compare(next, root) >= 0) {
+                break;
+            }
+
+            root.swap(next);
+        }
+
+        remainder = value;
+        Magnitude::subtract(remainder, powerMagnitude(root, degree));
+
+        return root;
+    }
+
+    template<class T>
+    BigIntBackend<T> sqrtrem(const BigIntBackend<T> &value, BigIntBackend<T> &remainder) {
+        return rootrem(value, 2, remainder);
+    }
+
+    template<class T>
+    BigIntBackend<T> isqrt(const BigIntBackend<T> &value) {
+        BigIntBackend<T> remainder;
+        return sqrtrem(value, remainder);
+    }
+
+    template<class T>
+    BigIntBackend<T> rootrem(const BigIntBackend<T> &value, std::size_t degree, BigIntBackend<T> &remainder) {
+        if (degree == 0) {
+            throw std::logic_error("Cannot take root of zero degree.");
+        }
+
+        bool isNegative = value.getSign() && !toMagnitude(value).empty();
+
+        if (isNegative && degree % 2 == 0) {
+            throw std::logic_error("Cannot take root of even degree of negative number.");
+        }
+
+        std::vector<T> remainderMagnitude;
+        std::vector<T> root = rootremMagnitude(toMagnitude(value), degree, remainderMagnitude);
+
+        remainder = fromMagnitude(remainderMagnitude, isNegative);
+
+        return fromMagnitude(root, isNegative);
+    }
+
+    template<class T>
+    BigIntBackend<T> iroot(const BigIntBackend<T> &value, std::size_t degree) {
+        BigIntBackend<T> remainder;
+        return rootrem(value, degree, remainder);
+    }
+
+    // Writes F(n) and F(n - 1) for n >= 1. Fast doubling goes from index k to 2k or 2k + 1 by two squarings:
+    // F(2k + 1) = 4F(k)^2 - F(k - 1)^2 + 2(-1)^k, F(2k - 1) = F(k)^2 + F(k - 1)^2, F(2k) = F(2k + 1) - F(2k - 1).
+    template<class T>
+    void fibonacciPair(uint64_t n, std::vector<T> &current, std::vector<T> &previous) {
+        const std::vector<T> two = Magnitude::fromUint64<T>(2);
+
+        current = {1};
+        previous.clear();
+
+        int top = 63;
+        while (((n >> top) & 1) == 0) {
+            --top;
+        }
+
+        for (int bit = top - 1; bit >= 0; --bit) {
+            bool isIndexOdd = ((n >> (bit + 1)) & 1) != 0;
+
+            std::vector<T> currentSquare = Magnitude::square(current);
+            std::vector<T> previousSquare = Magnitude::square(previous);
+
+            std::vector<T> next = currentSquare;
+            Magnitude::shiftLeft(next, 2);
+            Magnitude::subtract(next, previousSquare);
+
+            if (isIndexOdd) {
+                Magnitude::subtract(next, two);
+            } else {
+                Magnitude::add(next, two);
+            }
+
+            std::vector<T> last = currentSquare;
+            Magnitude::add(last, previousSquare);
+
+            std::vector<T> middle = next;
+            Magnitude::subtract(middle, last);
+
+            if ((n >> bit) & 1) {
+                current.swap(next);
+                previous.swap(middle);
+            } else {
+                current.swap(middle);
+                previous.swap(last);
+            }
+        }
+    }
+
+    template<class T>
+    BigIntBackend<T> fibonacci(uint64_t n) {
+        if (n == 0) {
+            return BigIntBackend<T>();
+        }
+
+        std::vector<T> current, previous;
+        fibonacciPair(n, current, previous);
+
+        return fromMagnitude(current, false);
+    }
+
+    template<class T>
+    BigIntBackend<T> lucas(uint64_t n) {
+        if (n == 0) {
+            return BigIntBackend<T>(2);
+        }
+
+        // L(n) = F(n) + 2F(n - 1)
+        std::vector<T> current, previous;
+        fibonacciPair(n, current, previous);
+
+        Magnitude::shiftLeft(previous, 1);
+        Magnitude::add(current, previous);
+
+        return fromMagnitude(current, false);
+    }
+
+    // Required for testing
+    template BigIntBackend<uint8_t> gcd(const BigIntBackend<uint8_t> &, const BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> lcm(const BigIntBackend<uint8_t> &, const BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> gcdext(const BigIntBackend<uint8_t> &, const BigIntBackend<uint8_t> &,
+                                           BigIntBackend<uint8_t> &, BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> modInverse(const BigIntBackend<uint8_t> &, const BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> chineseRemainder(const std::vector<BigIntBackend<uint8_t>> &,
+                                                     const std::vector<BigIntBackend<uint8_t>> &);
+
+    template BigIntBackend<uint8_t> sqrtrem(const BigIntBackend<uint8_t> &, BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> isqrt(const BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> rootrem(const BigIntBackend<uint8_t> &, std::size_t, BigIntBackend<uint8_t> &);
+
+    template BigIntBackend<uint8_t> iroot(const BigIntBackend<uint8_t> &, std::size_t);
+
+    template BigIntBackend<uint8_t> fibonacci<uint8_t>(uint64_t);
+
+    template BigIntBackend<uint8_t> lucas<uint8_t>(uint64_t);
+
+    // Required for final result
+    template BigIntBackend<PieceType> gcd(const BigIntBackend<PieceType> &, const BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> lcm(const BigIntBackend<PieceType> &, const BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> gcdext(const BigIntBackend<PieceType> &, const BigIntBackend<PieceType> &,
+                                             BigIntBackend<PieceType> &, BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> modInverse(const BigIntBackend<PieceType> &,
+                                                 const BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> chineseRemainder(const std::vector<BigIntBackend<PieceType>> &,
+                                                       const std::vector<BigIntBackend<PieceType>> &);
+
+    template BigIntBackend<PieceType> sqrtrem(const BigIntBackend<PieceType> &, BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> isqrt(const BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> rootrem(const BigIntBackend<PieceType> &, std::size_t,
+                                              BigIntBackend<PieceType> &);
+
+    template BigIntBackend<PieceType> iroot(const BigIntBackend<PieceType> &, std::size_t);
+
+    template BigIntBackend<PieceType> fibonacci<PieceType>(uint64_t);
+
+    template BigIntBackend<PieceType> lucas<PieceType>(uint64_t);
+
+    // Additional tests, 64-bit pieces need 128-bit products
+#ifdef __SIZEOF_INT128__
+    template BigIntBackend<uint64_t> gcd(const BigIntBackend<uint64_t> &, const BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> lcm(const BigIntBackend<uint64_t> &, const BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> gcdext(const BigIntBackend<uint64_t> &, const BigIntBackend<uint64_t> &,
+                                            BigIntBackend<uint64_t> &, BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> modInverse(const BigIntBackend<uint64_t> &, const BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> chineseRemainder(const std::vector<BigIntBackend<uint64_t>> &,
+                                                      const std::vector<BigIntBackend<uint64_t>> &);
+
+    template BigIntBackend<uint64_t> sqrtrem(const BigIntBackend<uint64_t> &, BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> isqrt(const BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> rootrem(const BigIntBackend<uint64_t> &, std::size_t, BigIntBackend<uint64_t> &);
+
+    template BigIntBackend<uint64_t> iroot(const BigIntBackend<uint64_t> &, std::size_t);
+
+    template BigIntBackend<uint64_t> fibonacci<uint64_t>(uint64_t);
+
+    template BigIntBackend<uint64_t> lucas<uint64_t>(uint64_t);
+#endif
+}
@@ -0,0 +1,60 @@
+#ifndef BIG_NUMBERS_NUMBERTHEORYUTILS_H
+#define BIG_NUMBERS_NUMBERTHEORYUTILS_H
+
+#include "BigIntBackend.h"
+
+#include <vector>
+
+namespace BigNumbers {
+    // Greatest common divisor of absolute values of both arguments. Small operands are handled by binary algorithm,
+    // medium ones by Lehmer's algorithm and large ones by recursive half-gcd.
+    template<class T>
+    BigIntBackend<T> gcd(const BigIntBackend<T> &first, const BigIntBackend<T> &second);
+
+    // Least common multiple of absolute values of both arguments.
+    template<class T>
+    BigIntBackend<T> lcm(const BigIntBackend<T> &first, const BigIntBackend<T> &second);
+
+    // Greatest common divisor of absolute values of both arguments. Bezout coefficients, satisfying
+    // first * firstCoefficient + second * secondCoefficient = gcd, are written to the last two arguments.
+    template<class T>
+    BigIntBackend<T> gcdext(const BigIntBackend<T> &first, const BigIntBackend<T> &second,
+                            BigIntBackend<T> &firstCoefficient, BigIntBackend<T> &secondCoefficient);
+
+    // Inverse of value modulo positive modulus, which lies in range [0, modulus).
+    template<class T>
+    BigIntBackend<T> modInverse(const BigIntBackend<T> &value, const BigIntBackend<T> &modulus);
+
+    // Smallest non-negative value, which is congruent to each residue modulo corresponding modulus. Moduli must be
+    // positive and pairwise coprime. Pairs are combined through product and remainder trees, so only the leaves need
+    // modular inverses of single moduli.
+    template<class T>
+    BigIntBackend<T> chineseRemainder(const std::vector<BigIntBackend<T>> &residues,
+                                      const std::vector<BigIntBackend<T>> &moduli);
+
+    // Floor of square root of non-negative value. Remainder value - root^2 is written to the last argument. Uses
+    // Karatsuba square root, which costs about as much as a few multiplications of values of the same size.
+    template<class T>
+    BigIntBackend<T> sqrtrem(const BigIntBackend<T> &value, BigIntBackend<T> &remainder);
+
+    template<class T>
+    BigIntBackend<T> isqrt(const BigIntBackend<T> &value);
+
+    // Root of given degree, rounded towards zero. Remainder value - root^degree is written to the last argument.
+    // Negative values are accepted only for odd degrees.
+    template<class T>
+    BigIntBackend<T> rootrem(const BigIntBackend<T> &value, std::size_t degree, BigIntBackend<T> &remainder);
+
+    template<class T>
+    BigIntBackend<T> iroot(const BigIntBackend<T> &value, std::size_t degree);
+
+    // n-th Fibonacci number, computed by fast doubling with O(log n) squarings.
+    template<class T>
+    BigIntBackend<T> fibonacci(uint64_t n);
+
+    // n-th Lucas number: L(0) = 2, L(1) = 1, L(n) = L(n - 1) + L(n - 2).
+    template<class T>
+    BigIntBackend<T> lucas(uint64_t n);
+}
+
+#endif //BIG_NUMBERS_NUMBERTHEORYUTILS_H
@@ -1,160 +1,70 @@
 #include "ParsingUtils.h"
 
-#include <bitset>
-#include <regex>
+#include <algorithm>
 
+#include "DecimalUtils.h"
+#include "DivisionUtils.h"
 #include "VectorUtils.h"
 #include "config.h"
 
 namespace BigNumbers {
-    std::vector<uint8_t> decimalStringToNumbers(const std::string &source) {
-        std::vector<uint8_t> transformedSource;
-        transformedSource.resize(source.size());
-
-        std::transform(source.begin(), source.end(), transformedSource.begin(), [](char in) {
-            return in - '0';
-        });
-
-        return transformedSource;
+    // Whether substring is not empty and consists of decimal digits. Checked in a single pass, as matching by regex
+    // recurses for each character and overflows the stack for long values.
+    bool isDecimal(const std::string &source, std::size_t begin, std::size_t end) {
+        return begin < end && std::all_of(source.begin() + static_cast<std::ptrdiff_t>(begin),
+                                          source.begin() + static_cast<std::ptrdiff_t>(end),
+                                          [](char symbol) { return symbol >= '0' && symbol <= '9'; });
     }
 
-    template<class V>
-    void integralSourceToBinary(const std::string &source, std::vector<V> &out) {
-        std::vector<uint8_t> transformedSource = decimalStringToNumbers(source);
+    // Converts non-negative value / 10^decimalDigits to binary, keeping integral part and given amount of pieces after
+    // the point, or after the leading piece for values below one. The rest is rounded half up. Returns exponent of the
+    // top piece of value.
+    template<class T>
+    int32_t fractionToBinary(BigIntBackend<T> &value, std::size_t decimalDigits, std::size_t precision) {
+        constexpr std::size_t BIT_COUNT = 8 * sizeof(T);
 
-        uint8_t position = 0;
-        constexpr std::size_t BIT_COUNT = 8 * sizeof(V);
-        std::bitset<BIT_COUNT> buff;
+        BigIntBackend<T> divisor = powerOfTen<T>(decimalDigits);
 
-        while (!transformedSource.empty()) {
-            bool carry = false;
-            uint8_t &current = transformedSource.back();
+        // Quotient exceeds base^(valueSize - divisorSize - 1), so there are at most divisorSize - valueSize zero pieces
+        // after the point. One more piece decides rounding.
+        std::size_t valueSize = value.accessPieces().size(), divisorSize = divisor.accessPieces().size();
+        std::size_t shift = precision + 1 + (divisorSize > valueSize ? divisorSize - valueSize : 0);
 
-            if (current % 2 == 0) {
-                buff.set(position, false);
-            } else {
-                buff.set(position, true);
-                current -= 1;
-            }
+        value.shiftLeft(shift * BIT_COUNT);
+        divideByNewton(value, divisor);
 
-            ++position;
-            if (position == BIT_COUNT) {
-                position = 0;
-                out.push_back(buff.to_ulong());
-                buff.reset();
-            }
-
-            for (uint8_t &member: transformedSource) {
-                bool oldCarry = carry;
-                carry = member % 2;
-                member /= 2;
-                if (oldCarry) {
-                    member += 5;
-                }
-            }
+        // Quotient is exact up to the last piece, so its top dropped bit is the half of the last kept one.
+        std::size_t dropped = std::min(value.accessPieces().size(), shift) - precision;
+        bool isRoundedUp = value.accessPieces()[dropped - 1] >> (BIT_COUNT - 1);
 
-            if (transformedSource[0] == 0) {
-                transformedSource.erase(transformedSource.begin());
-            }
-        }
+        dropPieces(value, dropped);
 
-        if (buff.any()) {
-            out.push_back(buff.to_ulong());
+        if (isRoundedUp) {
+            value.add(BigIntBackend<T>(1));
         }
-    }
 
-    template<class V>
-    uint32_t fractionalSourceToBinary(const std::string &source, std::size_t precision, std::vector<V> &output) {
-        std::size_t inputWidth = output.size();
-        constexpr std::size_t BIT_COUNT = 8 * sizeof(V);
+        value.normalize();
 
-        std::vector<uint8_t> transformedSource = decimalStringToNumbers(source);
-        uint8_t bufferIndex = 0;
-        std::bitset<BIT_COUNT> buffer;
-        int32_t exponent = 0;
-
-        if (output.empty()) {
-            --exponent;
+        if (value.accessPieces().empty()) {
+            return 0;
         }
 
-        std::size_t currentFractionDigit = 0;
-        while (!transformedSource.empty() && currentFractionDigit <= precision) {
-            bool carry = false;
-
-            for (auto member = transformedSource.rbegin(); member < transformedSource.rend(); ++member) {
-                *member = (*member) * 2 + carry;
-                carry = *member >= 10;
-                *member %= 10;
-            }
-
-            buffer.set(BIT_COUNT - bufferIndex - 1, carry);
-
-            if (transformedSource.back() == 0) {
-                transformedSource.pop_back();
-            }
-
-            ++bufferIndex;
-            if (bufferIndex == BIT_COUNT) {
-                bufferIndex = 0;
-
-                if (output.empty() && buffer.none()) {
-                    --exponent;
-                } else {
-                    ++currentFractionDigit;
-                    output.insert(output.begin(), buffer.to_ulong());
-                }
-
-                buffer.reset();
-            }
-        }
-
-        if (buffer.any()) {
-            output.insert(output.begin(), buffer.to_ulong());
-        }
-
-        if (output.size() > inputWidth + precision) {
-            buffer = std::bitset<BIT_COUNT>(output.front());
-            output.erase(output.begin());
-
-            if (buffer[BIT_COUNT - 1]) {
-                bool carry = true;
-                for (auto it = output.begin(); it != output.end(); ++it) {
-                    V oldValue = *it;
-                    *it += 1;
-                    if (*it > oldValue) {
-                        carry = false;
-                        break;
-                    }
-                }
-
-                if (carry) {
-                    output.push_back(0b1);
-                    ++exponent;
-                }
-
-                trimBack(output, (V) 0);
-            }
-        }
-
-        return output.empty() ? 0 : exponent;
+        return static_cast<int32_t>(value.accessPieces().size() + dropped) - static_cast<int32_t>(shift) - 1;
     }
 
     template<class T>
     BigIntBackend<T> parseBigInt(std::string source) {
-        std::regex bigIntRegex("^-?\\d+$");
-
-        if (!std::regex_match(source, bigIntRegex)) {
-            throw std::invalid_argument("Invalid BigIntBackend format");
-        }
-
-        uint8_t sign = source[0] == '-';
+        uint8_t sign = !source.empty() && source[0] == '-';
 
         if (sign) {
             source.erase(source.begin());
         }
 
-        BigIntBackend<T> out;
-        integralSourceToBinary<T>(source, out.accessPieces());
+        if (!isDecimal(source, 0, source.size())) {
+            throw std::invalid_argument("Invalid BigIntBackend format");
+        }
+
+        BigIntBackend<T> out = fromDecimalString<T>(source);
 
         if (sign) {
             out.negate();
@@ -165,31 +75,59 @@ namespace BigNumbers {
 
     template<typename T>
     BigFloatBackend<T> parseBigFloat(std::string source, std::size_t precision) {
-        std::regex bigFloatRegex(R"(^-?\d+\.\d+$)");
+        uint8_t sign = !source.empty() && source[0] == '-';
 
-        if (!std::regex_match(source, bigFloatRegex)) {
-            throw std::invalid_argument("Invalid BigFloatBackend format");
+        if (sign) {
+            source.erase(source.begin());
         }
 
-        uint8_t sign = source[0] == '-';
+        // Value is digits without the point times 10^decimalExponent.
+        int64_t decimalExponent = 0;
 
-        if (sign) {
-            source.erase(source.begin());
+        std::string::size_type exponentPosition = source.find_first_of("eE");
+        if (exponentPosition != std::string::npos) {
+            std::size_t digitsPosition = exponentPosition + 1;
+            if (digitsPosition < source.size() && (source[digitsPosition] == '-' || source[digitsPosition] == '+')) {
+                ++digitsPosition;
+            }
+
+            if (!isDecimal(source, digitsPosition, source.size())) {
+                throw std::invalid_argument("Invalid BigFloatBackend format");
+            }
+
+            decimalExponent = std::stoll(source.substr(exponentPosition + 1));
+            source.erase(exponentPosition);
         }
 
         std::string::size_type dotPosition = source.find('.');
-        BigIntBackend<T> mantissa;
-        integralSourceToBinary<T>(source.substr(0, dotPosition), mantissa.accessPieces());
+        if (dotPosition != std::string::npos) {
+            if (!isDecimal(source, dotPosition + 1, source.size())) {
+                throw std::invalid_argument("Invalid BigFloatBackend format");
+            }
 
-        trimBack(mantissa.accessPieces(), (T) 0);
+            decimalExponent -= static_cast<int64_t>(source.size() - dotPosition - 1);
+            source.erase(dotPosition, 1);
+        }
 
-        int32_t exponent = std::max(mantissa.accessPieces().size(), static_cast<std::size_t>(1)) - 1;
+        if (!isDecimal(source, 0, dotPosition == std::string::npos ? source.size() : dotPosition)) {
+            throw std::invalid_argument("Invalid BigFloatBackend format");
+        }
+
+        BigIntBackend<T> mantissa = fromDecimalString<T>(source);
+        int32_t exponent = 0;
 
-        int32_t exponentCorrection = fractionalSourceToBinary<T>(source.substr(dotPosition + 1),
-                                                                 precision,
-                                                                 mantissa.accessPieces());
+        if (mantissa.accessPieces().empty()) {
+            return BigFloatBackend<T>(mantissa, exponent);
+        }
 
-        exponent += exponentCorrection;
+        if (decimalExponent >= 0) {
+            // Integral values are kept exactly.
+            mantissa.multiply(powerOfTen<T>(decimalExponent));
+            mantissa.normalize();
+            exponent = static_cast<int32_t>(mantissa.accessPieces().size()) - 1;
+        } else {
+            exponent = fractionToBinary(mantissa, -decimalExponent, precision);
+        }
 
         trimFront(mantissa.accessPieces(), (T) 0);
 
@@ -206,6 +144,11 @@ namespace BigNumbers {
     // Required for final result
     template BigIntBackend<PieceType> parseBigInt(std::string source);
 
+    // Additional tests, 64-bit pieces need 128-bit products
+#ifdef __SIZEOF_INT128__
+    template BigIntBackend<uint64_t> parseBigInt(std::string source);
+#endif
+
     // Required for testing
     template BigFloatBackend<uint8_t> parseBigFloat(std::string source, std::size_t mantissaWidth);
 
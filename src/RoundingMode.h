@@ -0,0 +1,17 @@
+#ifndef BIG_NUMBERS_ROUNDINGMODE_H
+#define BIG_NUMBERS_ROUNDINGMODE_H
+
+namespace BigNumbers {
+    // Direction, in which results of arithmetic operations are rounded to their precision.
+    enum class RoundingMode {
+        // To the nearest representable value, ties go to the one with even last bit.
+        NEAREST_EVEN,
+        TOWARD_ZERO,
+        // Towards positive infinity.
+        UP,
+        // Towards negative infinity, which is truncation of two's complement mantissa.
+        DOWN
+    };
+}
+
+#endif //BIG_NUMBERS_ROUNDINGMODE_H
@@ -0,0 +1,50 @@
+#include "Stats.h"
+
+namespace BigNumbers {
+    namespace Stats {
+        std::atomic<uint64_t> counters[COUNTER_COUNT];
+
+        bool isEnabled() {
+#ifdef BIG_NUMBERS_STATS
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        Snapshot snapshot() {
+            auto read = [](Counter counter) {
+                return counters[counter].load(std::memory_order_relaxed);
+            };
+
+            Snapshot result;
+
+            result.additions = read(ADDITIONS);
+            result.multiplications = read(MULTIPLICATIONS);
+            result.divisions = read(DIVISIONS);
+            result.comparisons = read(COMPARISONS);
+            result.normalizations = read(NORMALIZATIONS);
+            result.floatAdditions = read(FLOAT_ADDITIONS);
+            result.floatMultiplications = read(FLOAT_MULTIPLICATIONS);
+            result.floatDivisions = read(FLOAT_DIVISIONS);
+            result.limbsProcessed = read(LIMBS_PROCESSED);
+            result.allocations = read(ALLOCATIONS);
+            result.allocatedBytes = read(ALLOCATED_BYTES);
+            result.schoolbookMultiplications = read(SCHOOLBOOK_MULTIPLICATIONS);
+            result.karatsubaMultiplications = read(KARATSUBA_MULTIPLICATIONS);
+            result.parallelMultiplications = read(PARALLEL_MULTIPLICATIONS);
+            result.shortMultiplications = read(SHORT_MULTIPLICATIONS);
+            result.pieceDivisions = read(PIECE_DIVISIONS);
+            result.longDivisions = read(LONG_DIVISIONS);
+            result.newtonIterations = read(NEWTON_ITERATIONS);
+
+            return result;
+        }
+
+        void reset() {
+            for (auto &counter: counters) {
+                counter.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef BIG_NUMBERS_STATS_H
+#define BIG_NUMBERS_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Counters of hot-path operations, which show where time goes without a profiler. They are collected only when library
+// is built with BIG_NUMBERS_STATS option, otherwise counting compiles to nothing and all counters stay zero.
+
+#ifdef BIG_NUMBERS_STATS
+#define BIG_NUMBERS_COUNT(counter, amount) ::BigNumbers::Stats::count(::BigNumbers::Stats::counter, amount)
+#define BIG_NUMBERS_COUNT_ALLOCATION(bytes) ::BigNumbers::Stats::countAllocation(bytes)
+#else
+#define BIG_NUMBERS_COUNT(counter, amount) static_cast<void>(0)
+#define BIG_NUMBERS_COUNT_ALLOCATION(bytes) static_cast<void>(0)
+#endif
+
+namespace BigNumbers {
+    namespace Stats {
+        // Values of all counters since start of program or last reset. Operations built on other ones count them too,
+        // for instance, subtraction counts addition and multiplication counts negations of its operands.
+        struct Snapshot {
+            // Calls of BigIntBackend operations.
+            uint64_t additions = 0;
+            uint64_t multiplications = 0;
+            uint64_t divisions = 0;
+            uint64_t comparisons = 0;
+
+            // Trims of redundant top pieces, which follow most BigIntBackend results.
+            uint64_t normalizations = 0;
+
+            // Calls of BigFloatBackend operations.
+            uint64_t floatAdditions = 0;
+            uint64_t floatMultiplications = 0;
+            uint64_t floatDivisions = 0;
+
+            // Sum of operand lengths in pieces over all counted calls.
+            uint64_t limbsProcessed = 0;
+
+            // Heap allocations of pieces by copies of values and temporaries of multiplication and division.
+            uint64_t allocations = 0;
+            uint64_t allocatedBytes = 0;
+
+            // Method chosen for top level of each magnitude product.
+            uint64_t schoolbookMultiplications = 0;
+            uint64_t karatsubaMultiplications = 0;
+            uint64_t parallelMultiplications = 0;
+
+            // Products, which computed only top pieces by short product.
+            uint64_t shortMultiplications = 0;
+
+            // Method chosen for each integer division: single-piece divisor or long division.
+            uint64_t pieceDivisions = 0;
+            uint64_t longDivisions = 0;
+
+            // Newton iterations of roots and steps of BigFloat reciprocal.
+            uint64_t newtonIterations = 0;
+        };
+
+        enum Counter {
+            ADDITIONS,
+            MULTIPLICATIONS,
+            DIVISIONS,
+            COMPARISONS,
+            NORMALIZATIONS,
+            FLOAT_ADDITIONS,
+            FLOAT_MULTIPLICATIONS,
+            FLOAT_DIVISIONS,
+            LIMBS_PROCESSED,
+            ALLOCATIONS,
+            ALLOCATED_BYTES,
+            SCHOOLBOOK_MULTIPLICATIONS,
+            KARATSUBA_MULTIPLICATIONS,
+            PARALLEL_MULTIPLICATIONS,
+            SHORT_MULTIPLICATIONS,
+            PIECE_DIVISIONS,
+            LONG_DIVISIONS,
+            NEWTON_ITERATIONS,
+            COUNTER_COUNT
+        };
+
+        // Whether library was built with counters.
+        bool isEnabled();
+
+        Snapshot snapshot();
+
+        void reset();
+
+        extern std::atomic<uint64_t> counters[COUNTER_COUNT];
+
+        // Counters are shared by threads of the pool, but each one is independent, so relaxed order suffices.
+        inline void count(Counter counter, uint64_t amount) {
+            counters[counter].fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        inline void countAllocation(std::size_t bytes) {
+            if (bytes > 0) {
+                count(ALLOCATIONS, 1);
+                count(ALLOCATED_BYTES, bytes);
+            }
+        }
+    }
+}
+
+#endif //BIG_NUMBERS_STATS_H
@@ -0,0 +1,211 @@
+#include "ThreadPool.h"
+
+namespace BigNumbers {
+    namespace {
+        // Karatsuba products of 2048 pieces and more are long enough to outweigh task scheduling.
+        std::atomic<std::size_t> parallelMultiplicationThreshold(2048);
+
+        // Queue owned by current thread. Threads outside of the pool share queue 0.
+        thread_local std::size_t currentQueue = 0;
+
+        unsigned resolveThreadCount(unsigned threadCount) {
+            if (threadCount == 0) {
+                threadCount = std::thread::hardware_concurrency();
+            }
+
+            return threadCount == 0 ? 1 : threadCount;
+        }
+    }
+
+    void setThreadCount(unsigned threadCount) {
+        ThreadPool::instance().setThreadCount(threadCount);
+    }
+
+    unsigned getThreadCount() {
+        return ThreadPool::instance().getThreadCount();
+    }
+
+    void setParallelMultiplicationThreshold(std::size_t pieceCount) {
+        parallelMultiplicationThreshold = pieceCount;
+    }
+
+    std::size_t getParallelMultiplicationThreshold() {
+        return parallelMultiplicationThreshold;
+    }
+
+    ThreadPool::TaskGroup::TaskGroup() : pool(ThreadPool::instance()), pendingCount(0) {
+    }
+
+    ThreadPool::TaskGroup::~TaskGroup() {
+        waitForTasks();
+    }
+
+    void ThreadPool::TaskGroup::run(std::function<void()> task) {
+        auto guardedTask = [this, task]() {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        };
+
+        if (pool.getThreadCount() < 2) {
+            guardedTask();
+            return;
+        }
+
+        ++pendingCount;
+        pool.submit([this, guardedTask]() {
+            guardedTask();
+            --pendingCount;
+        });
+    }
+
+    void ThreadPool::TaskGroup::wait() {
+        waitForTasks();
+
+        std::exception_ptr firstFailure;
+        {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            std::swap(firstFailure, failure);
+        }
+
+        if (firstFailure) {
+            std::rethrow_exception(firstFailure);
+        }
+    }
+
+    void ThreadPool::TaskGroup::waitForTasks() {
+        while (pendingCount > 0) {
+            if (!pool.runPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    ThreadPool &ThreadPool::instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ThreadPool::ThreadPool() : threadCount(resolveThreadCount(0)), queuedCount(0), isStopping(false) {
+    }
+
+    ThreadPool::~ThreadPool() {
+        stop();
+    }
+
+    unsigned ThreadPool::getThreadCount() const {
+        return threadCount;
+    }
+
+    void ThreadPool::setThreadCount(unsigned newThreadCount) {
+        std::lock_guard<std::mutex> lock(startMutex);
+
+        stop();
+        threadCount = resolveThreadCount(newThreadCount);
+    }
+
+    // Workers are started lazily by the first submitted task.
+    void ThreadPool::start() {
+        if (!workers.empty()) {
+            return;
+        }
+
+        queues.clear();
+        for (unsigned i = 0; i < threadCount; ++i) {
+            queues.emplace_back(new TaskQueue());
+        }
+
+        for (std::size_t i = 1; i < threadCount; ++i) {
+            workers.emplace_back(&ThreadPool::work, this, i);
+        }
+    }
+
+    void ThreadPool::stop() {
+        isStopping = true;
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_all();
+
+        for (auto &worker: workers) {
+            worker.join();
+        }
+
+        workers.clear();
+        isStopping = false;
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(startMutex);
+            start();
+        }
+
+        TaskQueue &queue = *queues[currentQueue < queues.size() ? currentQueue : 0];
+
+        // Counter is increased first, so it never drops below amount of queued tasks.
+        ++queuedCount;
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_one();
+    }
+
+    bool ThreadPool::runPendingTask() {
+        std::size_t queueCount = queues.size();
+        std::function<void()> task;
+
+        for (std::size_t i = 0; i < queueCount && !task; ++i) {
+            TaskQueue &queue = *queues[(currentQueue + i) % queueCount];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+
+            if (queue.tasks.empty()) {
+                continue;
+            }
+
+            // Own queue is used as a stack, which keeps recently split subtasks on the same thread.
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+
+        if (!task) {
+            return false;
+        }
+
+        --queuedCount;
+        task();
+
+        return true;
+    }
+
+    void ThreadPool::work(std::size_t queueIndex) {
+        currentQueue = queueIndex;
+
+        while (!isStopping) {
+            if (runPendingTask()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]() {
+                return isStopping || queuedCount > 0;
+            });
+        }
+    }
+}
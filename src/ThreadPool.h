@@ -0,0 +1,98 @@
+#ifndef BIG_NUMBERS_THREADPOOL_H
+#define BIG_NUMBERS_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BigNumbers {
+    // Sets amount of threads used by parallel arithmetic, including the calling one. Zero means one thread per
+    // hardware thread, one disables parallelism. Must not be called while parallel operation is running.
+    void setThreadCount(unsigned threadCount);
+
+    unsigned getThreadCount();
+
+    // Products of operands, which both have at least this amount of pieces, are split into tasks.
+    void setParallelMultiplicationThreshold(std::size_t pieceCount);
+
+    std::size_t getParallelMultiplicationThreshold();
+
+    // Work-stealing pool: each worker pushes and pops tasks at the back of its own queue, idle workers steal from
+    // the front of other queues. Threads, which wait for their tasks, execute pending tasks meanwhile, so tasks may
+    // spawn and wait for subtasks without blocking the pool.
+    class ThreadPool {
+    public:
+        // Group of tasks, which can be waited for together. First exception thrown by any task is rethrown by wait.
+        class TaskGroup {
+        public:
+            TaskGroup();
+
+            TaskGroup(const TaskGroup &) = delete;
+
+            TaskGroup &operator=(const TaskGroup &) = delete;
+
+            // Waits for remaining tasks, ignoring their exceptions.
+            ~TaskGroup();
+
+            void run(std::function<void()> task);
+
+            void wait();
+
+        private:
+            ThreadPool &pool;
+            std::atomic<std::size_t> pendingCount;
+            std::mutex failureMutex;
+            std::exception_ptr failure;
+
+            void waitForTasks();
+        };
+
+        static ThreadPool &instance();
+
+        ~ThreadPool();
+
+        unsigned getThreadCount() const;
+
+        void setThreadCount(unsigned threadCount);
+
+    private:
+        struct TaskQueue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        unsigned threadCount;
+
+        // Queue 0 receives tasks from threads outside of the pool, queue i belongs to worker i.
+        std::vector<std::unique_ptr<TaskQueue>> queues;
+        std::vector<std::thread> workers;
+
+        std::atomic<std::size_t> queuedCount;
+        std::atomic<bool> isStopping;
+        std::mutex sleepMutex;
+        std::condition_variable wakeUp;
+        std::mutex startMutex;
+
+        ThreadPool();
+
+        void start();
+
+        void stop();
+
+        void submit(std::function<void()> task);
+
+        // Executes one queued task, preferring own queue of calling worker. Returns false if there was none.
+        bool runPendingTask();
+
+        void work(std::size_t queueIndex);
+    };
+}
+
+#endif //BIG_NUMBERS_THREADPOOL_H
@@ -0,0 +1,154 @@
+#include "BigFloatBackend.h"
+#include "../utils.h"
+
+#include <iostream>
+
+using namespace BigNumbers;
+
+bool testTrimBits() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b10110111, 0b11101101, 0b00000001}), 0);
+
+    value.trimBits(11);
+
+    BigIntBackend<uint8_t> mantissa(false, {0b10100000, 0b11101101, 0b00000001});
+
+    return testBigFloat(value, BigFloatBackend<uint8_t>(mantissa, 0));
+}
+
+bool testTrimNegativeBits() {
+    BigIntBackend<uint8_t> mantissa(false, {0b10110111, 0b00000001});
+    mantissa.negate();
+    BigFloatBackend<uint8_t> value(mantissa, 0); // -1.71484375
+
+    value.trimBits(3);
+
+    // Lower bits are dropped from two's complement, so value is rounded down to -1.75.
+    BigIntBackend<uint8_t> expectedMantissa(false, {0b11000000, 0b00000001});
+    expectedMantissa.negate();
+
+    return testBigFloat(value, BigFloatBackend<uint8_t>(expectedMantissa, 0));
+}
+
+bool testWholePieces() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b10110111, 0b11101101, 0b00000001}), 0);
+    BigFloatBackend<uint8_t> expected = value;
+
+    value.trimBits(8);
+    expected.trim(1);
+
+    return testBigFloat(value, expected);
+}
+
+bool testBitExponent() {
+    BigFloatBackend<uint8_t> fraction(BigIntBackend<uint8_t>(false, {0b00010110}), -2); // 22 / 2^16
+    BigFloatBackend<uint8_t> integer(BigIntBackend<uint8_t>(false, {0b00000000, 0b00000001}), 1); // 2^8
+
+    BigIntBackend<uint8_t> negativeMantissa(false, {0b00000000, 0b00000001});
+    negativeMantissa.negate();
+    BigFloatBackend<uint8_t> negative(negativeMantissa, 1); // -2^8
+
+    if (fraction.getBitExponent() != -12 || integer.getBitExponent() != 8 || negative.getBitExponent() != 8) {
+        std::cout << "Bit exponents: " << fraction.getBitExponent() << ", " << integer.getBitExponent() << ", "
+                  << negative.getBitExponent() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool testScaleBits() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b00010110}), -2); // 22 / 2^16
+
+    value.scaleBits(12);
+
+    if (!testBigFloat(value, BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(false, {0b01100000, 0b00000001}), 0))) {
+        return false;
+    }
+
+    value.scaleBits(-13);
+
+    return value.compare(BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(false, {0b00001011}), -2)) == 0;
+}
+
+bool testScaleNegativeOne() {
+    BigIntBackend<uint8_t> mantissa(false, {0b00000001});
+    mantissa.negate();
+    mantissa.normalize();
+    BigFloatBackend<uint8_t> value(mantissa, 0); // -1
+
+    value.scaleBits(-3);
+
+    BigIntBackend<uint8_t> expectedMantissa(false, {0b00100000});
+    expectedMantissa.negate();
+
+    return value.compare(BigFloatBackend<uint8_t>(expectedMantissa, -1)) == 0;
+}
+
+// 91 is rounded to 3 significant bits at every position of its leading bit within a piece.
+bool testSignificantBits() {
+    for (int shift = 0; shift < 16; ++shift) {
+        BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(91));
+        value.scaleBits(shift - 8);
+
+        value.round({10, RoundingMode::NEAREST_EVEN, 3});
+        value.scaleBits(8 - shift);
+
+        if (value.compare(BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(96))) != 0) {
+            std::cout << "Shift " << shift << ": " << value.toBinaryString() << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testSignificantBitsBelowPower() {
+    BigIntBackend<uint8_t> mantissa(false, {0b00010000});
+    mantissa.negate();
+    BigFloatBackend<uint8_t> value(mantissa, 0); // -16
+
+    // Exact value lies above -16, so its leading bit is 3 and it is rounded up to -14.
+    value.round({10, RoundingMode::UP, 3}, true);
+
+    return value.compare(BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(-14))) == 0;
+}
+
+// Sum lies above -2^16 by 2^-40, which is far below the lowest stored piece, so its leading bit is 15.
+bool testSignificantBitsOfSumBelowPower() {
+    for (RoundingMode mode : {RoundingMode::TOWARD_ZERO, RoundingMode::UP}) {
+        for (std::size_t significantBits : {4, 15}) {
+            BigIntBackend<uint8_t> mantissa(false, {0b00000000, 0b00000000, 0b00000001});
+            mantissa.negate();
+            BigFloatBackend<uint8_t> value(mantissa, 2); // -2^16
+
+            value.add(BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(1), -5), {24, mode, significantBits});
+
+            auto expected = -(INT64_C(1) << 16) + (INT64_C(1) << (16 - significantBits));
+
+            if (value.compare(BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(expected))) != 0) {
+                std::cout << "Bits " << significantBits << ": " << value.toBinaryString() << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Trim bits",                           testTrimBits},
+            {"Trim bits of negative",               testTrimNegativeBits},
+            {"Whole pieces",                        testWholePieces},
+            {"Bit exponent",                        testBitExponent},
+            {"Scale by bits",                       testScaleBits},
+            {"Scale negative one",                  testScaleNegativeOne},
+            {"Significant bits",                    testSignificantBits},
+            {"Significant bits below power",        testSignificantBitsBelowPower},
+            {"Significant bits of sum below power", testSignificantBitsOfSumBelowPower},
+    };
+
+    return runTests(tests);
+}
@@ -1,6 +1,7 @@
 #include "BigFloatBackend.h"
 
 #include <iostream>
+#include <random>
 
 #include "../utils.h"
 
@@ -38,12 +39,66 @@ bool testSmallFraction() {
     return areFloatsEqual(first, value, 9);
 }
 
+bool testNegative() {
+    BigFloatBackend<uint8_t> first(BigIntBackend<uint8_t>(false, {0b00000011}), 0); // 3
+    BigFloatBackend<uint8_t> second(BigIntBackend<uint8_t>(true, {0b11111100}), 0); // -4
+
+    first.divide(second, 10);
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(true, {0b01000000}), -1); // -0.75
+
+    return areFloatsEqual(first, value, 9);
+}
+
+bool testLongOperands() {
+    std::mt19937 generator(43);
+
+    for (int i = 0; i < 50; ++i) {
+        std::vector<uint8_t> dividendPieces, divisorPieces;
+
+        for (int j = 0; j < 40; ++j) {
+            dividendPieces.push_back(generator());
+            divisorPieces.push_back(generator());
+        }
+
+        // Divisor is between 1 and 256, so quotient keeps at least 100 pieces after point.
+        divisorPieces.back() |= 1;
+
+        BigFloatBackend<uint8_t> dividend(BigIntBackend<uint8_t>(false, dividendPieces), 2);
+        BigFloatBackend<uint8_t> divisor(BigIntBackend<uint8_t>(false, divisorPieces), 0);
+
+        BigFloatBackend<uint8_t> quotient = dividend;
+        quotient.divide(divisor, 100);
+        quotient.multiply(divisor, 120);
+
+        if (!areFloatsEqual(quotient, dividend, 97)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testDivisionByZero() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b00000001}), 0);
+
+    try {
+        value.divide(BigFloatBackend<uint8_t>(), 10);
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
 int main() {
     using test = bool (*)();
 
     std::vector<std::pair<std::string, test>> tests{
             {"Simple division",     testSimple},
-            {"Test small fraction", testSmallFraction}
+            {"Test small fraction", testSmallFraction},
+            {"Negative divisor",    testNegative},
+            {"Long operands",       testLongOperands},
+            {"Division by zero",    testDivisionByZero}
     };
 
     return runTests(tests);
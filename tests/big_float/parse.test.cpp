@@ -98,6 +98,54 @@ bool testPeriodic() {
     return testBigFloat(num, BigFloatBackend<uint8_t>(mantissa, exponent));
 }
 
+bool testExponent() {
+    BigIntBackend<uint8_t> mantissa(false, {0b11011100, 0b00000101});
+
+    return testBigFloat(parseBigFloat<uint8_t>("1.5e3", 2), BigFloatBackend<uint8_t>(mantissa, 1)) &&
+           testBigFloat(parseBigFloat<uint8_t>("25e-2", 2),
+                        BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(false, {0b01000000}), -1)) &&
+           testBigFloat(parseBigFloat<uint8_t>("-2.5E+1", 2), parseBigFloat<uint8_t>("-25.0", 2)) &&
+           testBigFloat(parseBigFloat<uint8_t>("1e-40", 4),
+                        parseBigFloat<uint8_t>("0." + std::string(39, '0') + "1", 4));
+}
+
+bool testLongFraction() {
+    // Value m / 2^(8 * count) has exactly 8 * count digits after the point, which are digits of m * 5^(8 * count).
+    std::vector<uint8_t> pieces{0b10110011, 0b01101001, 0b11100101, 0b00010111, 0b10001110, 0b01010110};
+    BigIntBackend<uint8_t> mantissa(false, pieces);
+
+    std::size_t count = 300;
+    auto exponent = static_cast<int32_t>(pieces.size()) - 1 - static_cast<int32_t>(count);
+
+    BigIntBackend<uint8_t> scaled = mantissa;
+    for (std::size_t i = 0; i < 8 * count; ++i) {
+        scaled.multiply(BigIntBackend<uint8_t>(5));
+    }
+
+    std::string digits = scaled.toString();
+    digits.insert(0, 8 * count - digits.length(), '0');
+
+    // The third piece from the top is rounded up.
+    BigIntBackend<uint8_t> rounded(false, {0b00011000, 0b10001110, 0b01010110});
+
+    return testBigFloat(parseBigFloat<uint8_t>("0." + digits, 10), BigFloatBackend<uint8_t>(mantissa, exponent)) &&
+           testBigFloat(parseBigFloat<uint8_t>("0." + digits, 3), BigFloatBackend<uint8_t>(rounded, exponent)) &&
+           testBigFloat(parseBigFloat<uint8_t>(digits + "e-" + std::to_string(8 * count), 10),
+                        BigFloatBackend<uint8_t>(mantissa, exponent));
+}
+
+bool testInvalid() {
+    for (const char *source: {"1.", ".5", "1e", "1.5e+", "1e5.0", "1e+-5", "--1.0", "-", ""}) {
+        try {
+            parseBigFloat<uint8_t>(source, 2);
+            return false;
+        } catch (std::invalid_argument &) {
+        }
+    }
+
+    return true;
+}
+
 int main() {
     using test = bool (*)();
 
@@ -111,7 +159,10 @@ int main() {
             {"Test rounding 3",       testRounding3},
             {"Test strip zeros",      testStripZeros},
             {"Test negative numbers", testNegative},
-            {"Test periodic",         testPeriodic}
+            {"Test periodic",         testPeriodic},
+            {"Test exponent",         testExponent},
+            {"Test long fraction",    testLongFraction},
+            {"Test invalid format",   testInvalid}
     };
 
     return runTests(tests);
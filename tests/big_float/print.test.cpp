@@ -51,6 +51,47 @@ bool testSmallRounding() {
     return value.toString(5, true) == "0.00000";
 }
 
+bool testScientific() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b01010101, 0b10010010}), 0);
+    BigFloatBackend<uint8_t> small(BigIntBackend<uint8_t>(false, {0b01010100}), -10);
+    BigFloatBackend<uint8_t> large(BigIntBackend<uint8_t>(false, {0b01010101, 0b10010010}), 10);
+
+    BigIntBackend<uint8_t> mantissa(false, {0b00000111});
+    mantissa.negate();
+    BigFloatBackend<uint8_t> negative(mantissa, -1);
+
+    return value.toScientificString(3) == "1.463e+02" && small.toScientificString(4) == "6.9483e-23" &&
+           large.toScientificString(5) == "1.76905e+26" &&
+           negative.toScientificString(2) == "-2.73e-02" && BigFloatBackend<uint8_t>().toScientificString(1) == "0.0e+00";
+}
+
+bool testScientificCarry() {
+    // 0.96875 rounds up to the next power of ten.
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b11111000}), -1);
+
+    return value.toScientificString(1) == "9.7e-01" && value.toScientificString(0) == "1e+00";
+}
+
+bool testExactFraction() {
+    // Value m / 2^(8 * count) has exactly 8 * count digits after the point, which are digits of m * 5^(8 * count).
+    std::vector<uint8_t> pieces{0b10110011, 0b01101001, 0b11100101, 0b00010111, 0b10001110, 0b01010110};
+    BigIntBackend<uint8_t> mantissa(false, pieces);
+
+    std::size_t count = 300;
+    BigFloatBackend<uint8_t> value(mantissa, static_cast<int32_t>(pieces.size()) - 1 - static_cast<int32_t>(count));
+
+    BigIntBackend<uint8_t> scaled = mantissa;
+    for (std::size_t i = 0; i < 8 * count; ++i) {
+        scaled.multiply(BigIntBackend<uint8_t>(5));
+    }
+
+    std::string digits = scaled.toString();
+    digits.insert(0, 8 * count + 1 - digits.length(), '0');
+    digits.insert(digits.end() - static_cast<std::ptrdiff_t>(8 * count), '.');
+
+    return value.toString(8 * count, true) == digits;
+}
+
 int main() {
     using test = bool (*)();
 
@@ -61,7 +102,10 @@ int main() {
             {"Negative value test",             testNegativeValue},
             {"Rounding test",                   testRounding},
             {"Rounding test 2",                 testRounding2},
-            {"Rounding negative value to zero", testSmallRounding}
+            {"Rounding negative value to zero", testSmallRounding},
+            {"Scientific notation",             testScientific},
+            {"Scientific rounding carry",       testScientificCarry},
+            {"Exact long fraction",             testExactFraction}
     };
 
     return runTests(tests);
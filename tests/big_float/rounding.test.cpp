@@ -0,0 +1,270 @@
+#include "BigFloatBackend.h"
+#include "NumberTheoryUtils.h"
+#include "../utils.h"
+
+#include <iostream>
+#include <random>
+
+using namespace BigNumbers;
+
+using Backend = BigFloatBackend<uint8_t>;
+using Rounding = Backend::Rounding;
+
+const RoundingMode MODES[] = {RoundingMode::NEAREST_EVEN, RoundingMode::TOWARD_ZERO, RoundingMode::UP,
+                              RoundingMode::DOWN};
+
+// Exact values are computed down to this piece, which lies far below pieces kept by tests.
+constexpr int32_t DEEP_EXPONENT = -64;
+
+int32_t getLowExponent(const Backend &value) {
+    return value.getExponent() + 1 - static_cast<int32_t>(std::max<std::size_t>(
+            value.getMantissa().accessPieces().size(), 1));
+}
+
+Backend fromMagnitude(BigIntBackend<uint8_t> magnitude, int32_t lowExponent, bool isNegative) {
+    magnitude.normalize();
+    auto exponent = lowExponent + static_cast<int32_t>(magnitude.accessPieces().size()) - 1;
+
+    if (isNegative) {
+        magnitude.negate();
+    }
+
+    return Backend(magnitude, exponent);
+}
+
+// Value, which is floor of exact one at deep exponent, and whether exact value lies above it.
+Backend fromFloor(BigIntBackend<uint8_t> floor, bool isAboveFloor, bool isNegative) {
+    // Negative value -(floor + rest) is stored as -(floor + 1), which the rest lies above.
+    if (isNegative && isAboveFloor) {
+        floor.add(BigIntBackend<uint8_t>(1));
+    }
+
+    return fromMagnitude(floor, DEEP_EXPONENT, isNegative);
+}
+
+bool checkResult(const std::string &operation, const Backend &received, bool isInexact, const Backend &expected,
+                 bool isExpectedInexact, const Rounding &rounding) {
+    if (received.compare(expected) == 0 && isInexact == isExpectedInexact) {
+        return true;
+    }
+
+    std::cout << operation << " rounded to " << rounding.fractionBits << " bits in mode "
+              << static_cast<int>(rounding.mode) << " failed:\n"
+              << "Expected: " << expected.toBinaryString() << (isExpectedInexact ? " inexact" : " exact") << '\n'
+              << "Received: " << received.toBinaryString() << (isInexact ? " inexact" : " exact") << std::endl;
+
+    return false;
+}
+
+// Long magnitudes make products and quotients approximate before rounding.
+BigIntBackend<uint8_t> randomMagnitude(std::mt19937_64 &generator) {
+    std::vector<uint8_t> pieces(generator() % (generator() % 4 == 0 ? 40 : 6) + 1);
+    for (auto &piece: pieces) {
+        piece = static_cast<uint8_t>(generator());
+    }
+    pieces.back() |= 1;
+
+    return BigIntBackend<uint8_t>(false, pieces);
+}
+
+bool testRoundTies() {
+    // 1.5, 2.5 and -1.5 are rounded to integers.
+    Backend values[] = {Backend(BigIntBackend<uint8_t>(false, {0b10000000, 0b00000001}), 0),
+                        Backend(BigIntBackend<uint8_t>(false, {0b10000000, 0b00000010}), 0),
+                        fromMagnitude(BigIntBackend<uint8_t>(false, {0b10000000, 0b00000001}), -1, true)};
+    int expected[][4] = {{2,  1,  2,  1},
+                         {2,  2,  3,  2},
+                         {-2, -1, -1, -2}};
+
+    for (int i = 0; i < 3; ++i) {
+        for (int mode = 0; mode < 4; ++mode) {
+            Backend value = values[i];
+            Rounding rounding{0, MODES[mode]};
+
+            bool isInexact = value.round(rounding);
+
+            Backend integer(BigIntBackend<uint8_t>(expected[i][mode]));
+            if (!checkResult("Round", value, isInexact, integer, true, rounding)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool testRoundBits() {
+    // 1.0110101 is rounded to 3 bits after the point.
+    Backend value(BigIntBackend<uint8_t>(false, {0b01101010, 0b00000001}), 0);
+    Rounding rounding{3, RoundingMode::NEAREST_EVEN};
+
+    bool isInexact = value.round(rounding);
+
+    return checkResult("Round", value, isInexact, Backend(BigIntBackend<uint8_t>(false, {0b01100000, 0b00000001}), 0),
+                       true, rounding);
+}
+
+bool testRoundCarry() {
+    // 255.9 is rounded up to 256, which takes a new piece.
+    Backend value(BigIntBackend<uint8_t>(false, {0b11100110, 0b11111111}), 0);
+    Rounding rounding{0, RoundingMode::UP};
+
+    bool isInexact = value.round(rounding);
+
+    return checkResult("Round", value, isInexact, Backend(BigIntBackend<uint8_t>(256)), true, rounding);
+}
+
+// Random operands with random signs and exponents are rounded to random precisions. Sums and products are compared
+// with rounded exact ones, quotients and roots with exact floors far below kept pieces.
+bool testRandom() {
+    std::mt19937_64 generator(47);
+
+    for (int i = 0; i < 3000; ++i) {
+        BigIntBackend<uint8_t> firstMagnitude = randomMagnitude(generator);
+        BigIntBackend<uint8_t> secondMagnitude = randomMagnitude(generator);
+
+        // Divisible operands make exact quotients.
+        if (i % 5 == 0) {
+            firstMagnitude = secondMagnitude;
+            firstMagnitude.multiply(randomMagnitude(generator));
+        }
+
+        auto firstLowExponent = static_cast<int32_t>(generator() % 9) - 6;
+        auto secondLowExponent = static_cast<int32_t>(generator() % 9) - 6;
+        bool isFirstNegative = generator() % 2 != 0;
+        bool isSecondNegative = generator() % 2 != 0;
+
+        Backend first = fromMagnitude(firstMagnitude, firstLowExponent, isFirstNegative);
+        Backend second = fromMagnitude(secondMagnitude, secondLowExponent, isSecondNegative);
+
+        // Every other rounding keeps significant bits, so that its position depends on the leading bit.
+        RoundingMode mode = MODES[generator() % 4];
+        std::size_t significantBits = generator() % 30 + 1;
+        Rounding rounding = i % 2 == 0 ? Rounding(generator() % 40, mode)
+                                       : Rounding(significantBits + 7, mode, significantBits);
+
+        Backend sum = first;
+        bool isSumInexact = sum.add(second, rounding);
+        Backend exactSum = first;
+        exactSum.add(second);
+        bool isExactSumInexact = exactSum.round(rounding);
+
+        if (!checkResult("Sum", sum, isSumInexact, exactSum, isExactSumInexact, rounding)) {
+            return false;
+        }
+
+        Backend difference = first;
+        bool isDifferenceInexact = difference.subtract(second, rounding);
+        Backend exactDifference = first;
+        exactDifference.subtract(second);
+        bool isExactDifferenceInexact = exactDifference.round(rounding);
+
+        if (!checkResult("Difference", difference, isDifferenceInexact, exactDifference, isExactDifferenceInexact,
+                         rounding)) {
+            return false;
+        }
+
+        Backend product = first;
+        bool isProductInexact = product.multiply(second, rounding);
+        Backend exactProduct = first;
+        exactProduct.multiply(second, 1000);
+        bool isExactProductInexact = exactProduct.round(rounding);
+
+        if (!checkResult("Product", product, isProductInexact, exactProduct, isExactProductInexact, rounding)) {
+            return false;
+        }
+
+        Backend quotient = first;
+        bool isQuotientInexact = quotient.divide(second, rounding);
+
+        BigIntBackend<uint8_t> scaledDividend = firstMagnitude;
+        scaledDividend.shiftLeft((firstLowExponent - secondLowExponent - DEEP_EXPONENT) * 8);
+        BigIntBackend<uint8_t> remainder = scaledDividend.divide(secondMagnitude);
+        remainder.normalize();
+
+        Backend exactQuotient = fromFloor(scaledDividend, !remainder.accessPieces().empty(),
+                                          isFirstNegative != isSecondNegative);
+        bool isExactQuotientInexact = exactQuotient.round(rounding, !remainder.accessPieces().empty());
+
+        if (!checkResult("Quotient", quotient, isQuotientInexact, exactQuotient, isExactQuotientInexact, rounding)) {
+            return false;
+        }
+
+        Backend root = fromMagnitude(firstMagnitude, firstLowExponent, false);
+        bool isRootInexact = root.sqrt(rounding);
+
+        BigIntBackend<uint8_t> scaledRadicand = firstMagnitude;
+        scaledRadicand.shiftLeft((firstLowExponent - 2 * DEEP_EXPONENT) * 8);
+        BigIntBackend<uint8_t> rootRemainder;
+        BigIntBackend<uint8_t> rootFloor = sqrtrem(scaledRadicand, rootRemainder);
+        rootRemainder.normalize();
+
+        Backend exactRoot = fromFloor(rootFloor, !rootRemainder.accessPieces().empty(), false);
+        bool isExactRootInexact = exactRoot.round(rounding, !rootRemainder.accessPieces().empty());
+
+        if (!checkResult("Root", root, isRootInexact, exactRoot, isExactRootInexact, rounding)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Long operands at low precision are multiplied by short product, which is correctly rounded only when it is not
+// too close to a rounding point.
+bool testShortProducts() {
+    std::mt19937_64 generator(470);
+
+    for (int i = 0; i < 1000; ++i) {
+        std::vector<uint8_t> firstPieces(generator() % 30 + 30), secondPieces(generator() % 30 + 30);
+        for (auto &piece: firstPieces) {
+            piece = static_cast<uint8_t>(generator());
+        }
+        for (auto &piece: secondPieces) {
+            piece = static_cast<uint8_t>(i % 2 == 0 ? 0xff : generator());
+        }
+
+        Backend first = fromMagnitude(BigIntBackend<uint8_t>(false, firstPieces), -40, generator() % 2 != 0);
+        Backend second = fromMagnitude(BigIntBackend<uint8_t>(false, secondPieces), -50, generator() % 2 != 0);
+        Rounding rounding{generator() % 40, MODES[generator() % 4]};
+
+        Backend product = first;
+        bool isInexact = product.multiply(second, rounding);
+        Backend exactProduct = first;
+        exactProduct.multiply(second, 1000);
+        bool isExactInexact = exactProduct.round(rounding);
+
+        if (!checkResult("Product", product, isInexact, exactProduct, isExactInexact, rounding)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testNegativeRoot() {
+    Backend value = fromMagnitude(BigIntBackend<uint8_t>(4), 0, true);
+
+    try {
+        value.sqrt({8, RoundingMode::NEAREST_EVEN});
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Round ties",       testRoundTies},
+            {"Round bits",       testRoundBits},
+            {"Round with carry", testRoundCarry},
+            {"Random operands",  testRandom},
+            {"Short products",   testShortProducts},
+            {"Negative root",    testNegativeRoot},
+    };
+
+    return runTests(tests);
+}
@@ -2,6 +2,7 @@
 #include "../utils.h"
 
 #include <iostream>
+#include <random>
 
 using namespace BigNumbers;
 
@@ -71,6 +72,67 @@ bool testNegative2() {
     return testBigFloat(first, BigFloatBackend<uint8_t>(mantissa, exponent));
 }
 
+bool testSelfAddition() {
+    BigFloatBackend<uint8_t> value(BigIntBackend<uint8_t>(false, {0b11101000}), -1); // 0.90625
+
+    value.add(value);
+
+    return testBigFloat(value, BigFloatBackend<uint8_t>(BigIntBackend<uint8_t>(false, {0b11010000, 0b00000001}), 0));
+}
+
+// Sum trimmed to precision must equal exact sum, which is trimmed afterwards.
+bool testPrecision() {
+    std::mt19937_64 generator(45);
+
+    for (int i = 0; i < 2000; ++i) {
+        std::vector<uint8_t> firstPieces(generator() % 12 + 1), secondPieces(generator() % 12 + 1);
+        for (auto &piece: firstPieces) {
+            piece = generator();
+        }
+        for (auto &piece: secondPieces) {
+            piece = generator();
+        }
+
+        // Close exponents and equal top pieces make cancellation likely.
+        auto firstExponent = static_cast<int32_t>(generator() % 9) - 4;
+        auto secondExponent = firstExponent + static_cast<int32_t>(generator() % 3) - 1;
+        if (generator() % 2) {
+            secondPieces.back() = firstPieces.back();
+        }
+
+        BigIntBackend<uint8_t> firstMantissa(false, firstPieces), secondMantissa(false, secondPieces);
+        if (generator() % 2) {
+            firstMantissa.negate();
+        }
+        firstMantissa.normalize();
+        secondMantissa.normalize();
+
+        BigFloatBackend<uint8_t> first(firstMantissa, firstExponent), second(secondMantissa, secondExponent);
+        std::size_t precision = generator() % 5 + 1;
+
+        BigFloatBackend<uint8_t> exactSum = first, exactDifference = first;
+        exactSum.add(second);
+        exactSum.trim(precision);
+        exactDifference.subtract(second);
+        exactDifference.trim(precision);
+
+        BigFloatBackend<uint8_t> sum = first, difference = first;
+        sum.add(second, precision);
+        difference.subtract(second, precision);
+
+        // Trimmed exact sum may keep low zero pieces, which are dropped by bounded one, so values are compared.
+        if (sum.compare(exactSum) != 0 || difference.compare(exactDifference) != 0) {
+            std::cout << "Bounded sum:       " << sum.toBinaryString() << '\n'
+                      << "Trimmed exact sum: " << exactSum.toBinaryString() << '\n'
+                      << "Bounded difference:       " << difference.toBinaryString() << '\n'
+                      << "Trimmed exact difference: " << exactDifference.toBinaryString() << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int main() {
     using test = bool (*)();
 
@@ -79,7 +141,9 @@ int main() {
             {"Test exponent computation", testExponent},
             {"Test negative",             testNegative},
             {"Test negative 2",           testNegative2},
-            {"Test memory optimization", testMemoryOptimization}
+            {"Test memory optimization", testMemoryOptimization},
+            {"Self addition",            testSelfAddition},
+            {"Precision",                testPrecision},
     };
 
     return runTests(tests);
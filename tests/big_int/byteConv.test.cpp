@@ -66,6 +66,7 @@ bool testMultiplePiecesToBytes() {
     return compare(expected, expectedSize, bytesArray.first, bytesArray.second);
 }
 
+#ifdef __SIZEOF_INT128__
 bool testWidePiecesToBytes() {
     BigIntBackend<uint64_t> b(false, {0b0100001111001100000011110000111101000011110011000000111100001111});
 
@@ -78,6 +79,7 @@ bool testWidePiecesToBytes() {
 
     return compare(expected, expectedSize, bytesArray.first, bytesArray.second);
 }
+#endif
 
 int main() {
     using test = bool (*)();
@@ -85,7 +87,9 @@ int main() {
     std::vector<std::pair<std::string, test>> tests{
             {"One piece",                 testOnePieceToBytes},
             {"Multiple pieces to bytes",  testMultiplePiecesToBytes},
-            {"Test wide pieces to bytes", testWidePiecesToBytes}
+#ifdef __SIZEOF_INT128__
+            {"Test wide pieces to bytes", testWidePiecesToBytes},
+#endif
     };
 
     return runTests(tests);
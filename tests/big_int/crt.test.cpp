@@ -0,0 +1,98 @@
+#include "BigIntBackend.h"
+#include "NumberTheoryUtils.h"
+
+#include "../utils.h"
+
+#include <random>
+#include <stdexcept>
+
+using namespace BigNumbers;
+
+template<class T>
+BigIntBackend<T> residue(BigIntBackend<T> value, const BigIntBackend<T> &modulus) {
+    return value.divide(modulus);
+}
+
+bool testModInverse() {
+    BigIntBackend<uint8_t> modulus(1000003);
+
+    if (!testBigInt(modInverse(BigIntBackend<uint8_t>(3), BigIntBackend<uint8_t>(11)), BigIntBackend<uint8_t>(4)) ||
+        !testBigInt(modInverse(BigIntBackend<uint8_t>(-3), BigIntBackend<uint8_t>(11)), BigIntBackend<uint8_t>(7)) ||
+        !testBigInt(modInverse(BigIntBackend<uint8_t>(5), BigIntBackend<uint8_t>(1)), BigIntBackend<uint8_t>())) {
+        return false;
+    }
+
+    for (int64_t value = 2; value < 2000; value += 37) {
+        BigIntBackend<uint8_t> inverse = modInverse(BigIntBackend<uint8_t>(value), modulus);
+        inverse.multiply(BigIntBackend<uint8_t>(value));
+
+        if (!testBigInt(residue(inverse, modulus), BigIntBackend<uint8_t>(1))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testNotInvertible() {
+    try {
+        modInverse(BigIntBackend<uint8_t>(6), BigIntBackend<uint8_t>(9));
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+bool testSimple() {
+    std::vector<BigIntBackend<uint8_t>> residues{BigIntBackend<uint8_t>(2), BigIntBackend<uint8_t>(3),
+                                                 BigIntBackend<uint8_t>(2)};
+    std::vector<BigIntBackend<uint8_t>> moduli{BigIntBackend<uint8_t>(3), BigIntBackend<uint8_t>(5),
+                                               BigIntBackend<uint8_t>(7)};
+
+    return testBigInt(chineseRemainder(residues, moduli), BigIntBackend<uint8_t>(23)) &&
+           testBigInt(chineseRemainder(std::vector<BigIntBackend<uint8_t>>{BigIntBackend<uint8_t>(-1)},
+                                       std::vector<BigIntBackend<uint8_t>>{BigIntBackend<uint8_t>(10)}),
+                      BigIntBackend<uint8_t>(9));
+}
+
+// Reconstructs random value from its residues modulo many large primes.
+template<class T>
+bool testReconstruction(std::size_t pieceCount) {
+    std::mt19937_64 generator(pieceCount);
+
+    BigIntBackend<T> value = randomBackend<T>(pieceCount, generator);
+
+    // Squares of distinct primes, which together are longer than the value.
+    const int64_t primes[] = {1000000007, 1000000009, 998244353, 2147483647, 1000000021, 1000000033, 1000000087,
+                              1000000093, 1000000097, 1000000103, 1000000123, 1000000181, 1000000207, 1000000223,
+                              1000000241, 1000000271, 1000000289, 1000000297, 1000000321, 1000000349, 1000000363};
+
+    std::vector<BigIntBackend<T>> residues, moduli;
+    for (int64_t prime: primes) {
+        BigIntBackend<T> modulus(prime);
+        modulus.multiply(BigIntBackend<T>(prime));
+
+        moduli.push_back(modulus);
+        residues.push_back(residue(value, modulus));
+    }
+
+    return testBigInt(chineseRemainder(residues, moduli), value);
+}
+
+bool testReconstruction() {
+    return testReconstruction<uint8_t>(100) && testReconstruction<WidePiece>(19);
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Modular inverse",                   testModInverse},
+            {"Value without inverse",             testNotInvertible},
+            {"Simple test",                       testSimple},
+            {"Reconstruction from many residues", testReconstruction},
+    };
+
+    return runTests(tests);
+}
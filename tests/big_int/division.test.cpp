@@ -40,6 +40,16 @@ bool testNegative() {
     return testBigInt(one, BigIntBackend<uint8_t>(true, {0b11111110}));
 }
 
+bool testSinglePieceDivisor() {
+    BigIntBackend<uint8_t> one(false, {0b11111111, 0b11111111, 0b00000001});
+    BigIntBackend<uint8_t> two(false, {0b11111111});
+
+    BigIntBackend<uint8_t> remainder = one.divide(two);
+
+    return testBigInt(one, BigIntBackend<uint8_t>(false, {0b00000010, 0b00000010})) &&
+           testBigInt(remainder, BigIntBackend<uint8_t>(false, {0b00000001}));
+}
+
 int main() {
     using test = bool (*)();
 
@@ -48,6 +58,7 @@ int main() {
             {"Test with multiple pieces", testMultiplePieces},
             {"Test flooring",             testFlooring},
             {"Test negative",             testNegative},
+            {"Single piece divisor",      testSinglePieceDivisor},
     };
 
 
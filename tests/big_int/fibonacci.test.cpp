@@ -0,0 +1,54 @@
+#include "BigIntBackend.h"
+#include "NumberTheoryUtils.h"
+
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+template<class T>
+bool testSequence(BigIntBackend<T> (*function)(uint64_t), BigIntBackend<T> first, BigIntBackend<T> second) {
+    for (uint64_t n = 0; n < 600; ++n) {
+        if (!testBigInt(function(n), first)) {
+            std::cout << "Failed at index " << n << std::endl;
+            return false;
+        }
+
+        BigIntBackend<T> next = first;
+        next.add(second);
+        first = second;
+        second = next;
+    }
+
+    return true;
+}
+
+bool testFibonacci() {
+    return testSequence<uint8_t>(fibonacci<uint8_t>, BigIntBackend<uint8_t>(0), BigIntBackend<uint8_t>(1)) &&
+           testSequence<WidePiece>(fibonacci<WidePiece>, BigIntBackend<WidePiece>(0), BigIntBackend<WidePiece>(1));
+}
+
+bool testLucas() {
+    return testSequence<uint8_t>(lucas<uint8_t>, BigIntBackend<uint8_t>(2), BigIntBackend<uint8_t>(1));
+}
+
+// F(2n) = F(n) * L(n) for indices, where fast doubling runs through large values.
+bool testLargeIndex() {
+    const uint64_t n = 100003;
+
+    BigIntBackend<uint8_t> product = fibonacci<uint8_t>(n);
+    product.multiply(lucas<uint8_t>(n));
+
+    return testBigInt(fibonacci<uint8_t>(2 * n), product);
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Fibonacci numbers", testFibonacci},
+            {"Lucas numbers",     testLucas},
+            {"Large index",       testLargeIndex},
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,127 @@
+#include "BigIntBackend.h"
+#include "NumberTheoryUtils.h"
+
+#include "../utils.h"
+
+#include <random>
+
+using namespace BigNumbers;
+
+template<class T>
+BigIntBackend<T> mersenne(std::size_t exponent) {
+    BigIntBackend<T> value(1);
+    value.shiftLeft(exponent);
+    value.subtract(BigIntBackend<T>(1));
+    return value;
+}
+
+template<class T>
+BigIntBackend<T> product(BigIntBackend<T> first, const BigIntBackend<T> &second) {
+    first.multiply(second);
+    return first;
+}
+
+// Checks that result divides both values and is their linear combination with given coefficients.
+template<class T>
+bool isValidGcdext(const BigIntBackend<T> &first, const BigIntBackend<T> &second, const BigIntBackend<T> &result,
+                   const BigIntBackend<T> &firstCoefficient, const BigIntBackend<T> &secondCoefficient) {
+    BigIntBackend<T> combination = product(first, firstCoefficient);
+    combination.add(product(second, secondCoefficient));
+
+    if (combination.compare(result) != 0) {
+        std::cout << "Not a Bezout identity: " << combination.toString() << " != " << result.toString()
+                  << std::endl;
+        return false;
+    }
+
+    BigIntBackend<T> firstCopy = first, secondCopy = second;
+
+    return firstCopy.divide(result).compare(BigIntBackend<T>(0)) == 0 &&
+           secondCopy.divide(result).compare(BigIntBackend<T>(0)) == 0;
+}
+
+bool testSimple() {
+    return testBigInt(gcd(BigIntBackend<uint8_t>(12), BigIntBackend<uint8_t>(18)), BigIntBackend<uint8_t>(6)) &&
+           testBigInt(gcd(BigIntBackend<uint8_t>(0), BigIntBackend<uint8_t>(5)), BigIntBackend<uint8_t>(5)) &&
+           testBigInt(gcd(BigIntBackend<uint8_t>(-12), BigIntBackend<uint8_t>(18)), BigIntBackend<uint8_t>(6)) &&
+           testBigInt(gcd(BigIntBackend<uint8_t>(0), BigIntBackend<uint8_t>(0)), BigIntBackend<uint8_t>());
+}
+
+bool testLcm() {
+    return testBigInt(lcm(BigIntBackend<uint8_t>(4), BigIntBackend<uint8_t>(-6)), BigIntBackend<uint8_t>(12)) &&
+           testBigInt(lcm(BigIntBackend<uint8_t>(0), BigIntBackend<uint8_t>(6)), BigIntBackend<uint8_t>());
+}
+
+template<class T>
+bool testKnownDivisor(std::size_t divisorPieces, int firstPower, int secondPower) {
+    std::mt19937_64 generator(divisorPieces);
+
+    BigIntBackend<T> divisor = randomBackend<T>(divisorPieces, generator);
+    BigIntBackend<T> first = product(divisor, power(mersenne<T>(521), firstPower));
+    BigIntBackend<T> second = product(divisor, power(mersenne<T>(607), secondPower));
+
+    BigIntBackend<T> firstCoefficient, secondCoefficient;
+    BigIntBackend<T> result = gcdext(first, second, firstCoefficient, secondCoefficient);
+
+    BigIntBackend<T> multiple = product(divisor, power(mersenne<T>(521), firstPower));
+    multiple.multiply(power(mersenne<T>(607), secondPower));
+
+    return testBigInt(gcd(first, second), divisor) && testBigInt(result, divisor) &&
+           testBigInt(lcm(first, second), multiple) &&
+           isValidGcdext(first, second, result, firstCoefficient, secondCoefficient);
+}
+
+bool testLehmer() {
+    return testKnownDivisor<uint8_t>(40, 1, 1);
+}
+
+bool testHalfGcd() {
+    return testKnownDivisor<uint8_t>(250, 12, 11);
+}
+
+bool testWidePieces() {
+    return testKnownDivisor<WidePiece>(5, 1, 1) && testKnownDivisor<WidePiece>(32, 12, 11);
+}
+
+bool testGcdextSigns() {
+    std::mt19937_64 generator(7);
+
+    for (int signs = 0; signs < 4; ++signs) {
+        BigIntBackend<uint8_t> first = randomBackend<uint8_t>(60, generator);
+        BigIntBackend<uint8_t> second = randomBackend<uint8_t>(45, generator);
+
+        if (signs & 1) {
+            first.negate();
+        }
+
+        if (signs & 2) {
+            second.negate();
+        }
+
+        BigIntBackend<uint8_t> firstCoefficient, secondCoefficient;
+        BigIntBackend<uint8_t> result = gcdext(first, second, firstCoefficient, secondCoefficient);
+
+        if (!isValidGcdext(first, second, result, firstCoefficient, secondCoefficient) ||
+            !isValidGcdext(second, first, gcdext(second, first, secondCoefficient, firstCoefficient),
+                           secondCoefficient, firstCoefficient)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Simple test",           testSimple},
+            {"Least common multiple", testLcm},
+            {"Lehmer's algorithm",    testLehmer},
+            {"Half-gcd",              testHalfGcd},
+            {"Wide pieces",           testWidePieces},
+            {"Gcdext signs",          testGcdextSigns},
+    };
+
+    return runTests(tests);
+}
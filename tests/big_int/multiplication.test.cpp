@@ -1,4 +1,5 @@
 #include "BigIntBackend.h"
+#include "ThreadPool.h"
 
 #include "../utils.h"
 
@@ -47,6 +48,43 @@ bool testNegativeValues() {
     return testBigInt(first, result);
 }
 
+// Parallel products must match sequential ones for balanced and unbalanced operands.
+template<class T>
+bool testParallelProducts() {
+    std::mt19937_64 generator(5);
+
+    for (std::size_t firstSize: {300, 700, 2000}) {
+        BigIntBackend<T> first = randomBackend<T>(firstSize, generator);
+        BigIntBackend<T> second = randomBackend<T>(650, generator);
+        second.negate();
+
+        BigIntBackend<T> parallel = first;
+        parallel.multiply(second);
+
+        BigIntBackend<T> sequential = first;
+        sequential.multiply(second, false);
+
+        if (!testBigInt(parallel, sequential)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testParallelProducts() {
+    setThreadCount(4);
+    setParallelMultiplicationThreshold(64);
+
+    bool isSuccessful = testParallelProducts<uint8_t>() && testParallelProducts<WidePiece>();
+
+    setThreadCount(1);
+    isSuccessful = isSuccessful && testParallelProducts<uint8_t>();
+    setThreadCount(0);
+
+    return isSuccessful;
+}
+
 int main() {
     using test = bool (*)();
 
@@ -54,7 +92,8 @@ int main() {
             {"Single cell",          testSingleCell},
             {"Multiple cells",       testMultipleCells},
             {"Filled cells",         testFilledCells},
-            {"Test negative values", testNegativeValues}
+            {"Test negative values", testNegativeValues},
+            {"Parallel products",    testParallelProducts}
     };
 
 
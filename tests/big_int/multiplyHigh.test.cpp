@@ -0,0 +1,99 @@
+#include "BigIntBackend.h"
+
+#include "../utils.h"
+
+#include <random>
+
+using namespace BigNumbers;
+
+// Short product must keep at least width pieces and be less than exact product by less than base^3 units of its
+// lowest piece.
+template<class T>
+bool testShortProduct(BigIntBackend<T> first, const BigIntBackend<T> &second, std::size_t width) {
+    BigIntBackend<T> exact = first;
+    exact.multiply(second);
+
+    std::size_t dropped = first.multiplyHigh(second, width);
+
+    if (first.accessPieces().size() < std::min(width, exact.accessPieces().size())) {
+        std::cout << "Result of " << first.accessPieces().size() << " pieces is shorter than " << width << std::endl;
+        return false;
+    }
+
+    std::vector<T> &exactPieces = exact.accessPieces();
+    exactPieces.erase(exactPieces.begin(), exactPieces.begin() + std::min(dropped, exactPieces.size()));
+
+    exact.subtract(first);
+    exact.normalize();
+
+    if (exact.getSign() || exact.accessPieces().size() > 3) {
+        std::cout << "Error of short product is " << exact.toString() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+template<class T>
+bool testRandom() {
+    std::mt19937_64 generator(sizeof(T));
+
+    for (std::size_t size: {1, 5, 20, 31, 32, 50, 100, 300}) {
+        for (std::size_t width: {size / 2 + 1, size, size + 3}) {
+            BigIntBackend<T> first = randomBackend<T>(size, generator), second = randomBackend<T>(size, generator);
+            BigIntBackend<T> shorter = randomBackend<T>(size / 3 + 1, generator);
+
+            if (!testShortProduct(first, second, width) || !testShortProduct(first, shorter, width)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool testRandom() {
+    return testRandom<uint8_t>() && testRandom<uint16_t>() && testRandom<WidePiece>();
+}
+
+bool testAllOnes() {
+    // Every omitted partial product is maximal, so error of short product is the largest.
+    std::vector<uint8_t> pieces(300, 0b11111111);
+    BigIntBackend<uint8_t> value(false, pieces);
+
+    return testShortProduct(value, value, 290);
+}
+
+bool testNegativeValues() {
+    std::mt19937_64 generator(44);
+    BigIntBackend<uint16_t> first = randomBackend<uint16_t>(100, generator), second = randomBackend<uint16_t>(100, generator);
+
+    BigIntBackend<uint16_t> positive = first;
+    std::size_t positiveDropped = positive.multiplyHigh(second, 90);
+
+    first.negate();
+    std::size_t dropped = first.multiplyHigh(second, 90);
+    first.negate();
+
+    return dropped == positiveDropped && testBigInt(first, positive);
+}
+
+bool testShortOperands() {
+    BigIntBackend<uint8_t> first(false, {0b00000011});
+    BigIntBackend<uint8_t> second(false, {0b00000101});
+
+    return first.multiplyHigh(second, 10) == 0 && testBigInt(first, BigIntBackend<uint8_t>(false, {0b00001111}));
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Random operands",   testRandom},
+            {"All pieces filled", testAllOnes},
+            {"Negative values",   testNegativeValues},
+            {"Short operands",    testShortOperands},
+    };
+
+    return runTests(tests);
+}
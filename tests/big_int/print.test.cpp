@@ -1,7 +1,10 @@
 #include "BigIntBackend.h"
 
+#include <algorithm>
+#include <random>
 #include <sstream>
 
+#include "DecimalUtils.h"
 #include "../utils.h"
 
 using namespace BigNumbers;
@@ -39,6 +42,69 @@ bool testNegative() {
     return value.toString() == "-6";
 }
 
+// Digits by division by ten, which does not depend on conversion under test.
+template<class T>
+std::string toDigits(BigIntBackend<T> value) {
+    std::string digits;
+
+    do {
+        BigIntBackend<T> digit = value.divide(BigIntBackend<T>(10));
+        digits += static_cast<char>('0' + (digit.accessPieces().empty() ? 0 : digit.accessPieces().front()));
+        value.normalize();
+    } while (!value.accessPieces().empty());
+
+    std::reverse(digits.begin(), digits.end());
+
+    return digits;
+}
+
+template<class T>
+bool testRandom() {
+    std::mt19937_64 generator(sizeof(T));
+
+    for (std::size_t size: {1, 15, 16, 17, 40, 100, 257, 700}) {
+        BigIntBackend<T> value = randomBackend<T>(size, generator);
+
+        if (value.toString() != toDigits(value)) {
+            std::cout << "Failed to print value of " << size << " pieces" << std::endl;
+            return false;
+        }
+
+        value.normalize();
+
+        if (!testBigInt(fromDecimalString<T>("00" + toDigits(value)), value)) {
+            std::cout << "Failed to parse value of " << size << " pieces" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testRandom() {
+    return testRandom<uint8_t>() && testRandom<uint16_t>() && testRandom<WidePiece>();
+}
+
+bool testPowersOfTen() {
+    // Powers around the ones, which split values into halves.
+    for (std::size_t exponent: {31, 32, 33, 63, 64, 65, 128, 256, 500}) {
+        BigIntBackend<uint8_t> power(1);
+        for (std::size_t i = 0; i < exponent; ++i) {
+            power.multiply(BigIntBackend<uint8_t>(10));
+        }
+
+        BigIntBackend<uint8_t> below = power;
+        below.subtract(BigIntBackend<uint8_t>(1));
+
+        if (power.toString() != "1" + std::string(exponent, '0') || below.toString() != std::string(exponent, '9')) {
+            std::cout << "Failed to print 10^" << exponent << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int main() {
     using test = bool (*)();
 
@@ -47,7 +113,9 @@ int main() {
             {"Test multiple cells", testMultipleCells},
             {"Test large value",    testLargeValue},
             {"Test zero",           testZero},
-            {"Test negative",       testNegative}
+            {"Test negative",       testNegative},
+            {"Random values",       testRandom},
+            {"Powers of ten",       testPowersOfTen}
     };
 
 
@@ -0,0 +1,112 @@
+#include "BigIntBackend.h"
+#include "NumberTheoryUtils.h"
+
+#include "../utils.h"
+
+#include <random>
+#include <stdexcept>
+
+using namespace BigNumbers;
+
+// Checks that root^degree <= value < (root + 1)^degree and remainder is value - root^degree.
+template<class T>
+bool isValidRoot(const BigIntBackend<T> &value, std::size_t degree, const BigIntBackend<T> &root,
+                 const BigIntBackend<T> &remainder) {
+    BigIntBackend<T> next = root;
+    next.add(BigIntBackend<T>(1));
+
+    BigIntBackend<T> combination = power(root, degree);
+    combination.add(remainder);
+
+    if (combination.compare(value) != 0 || remainder.getSign() || power(next, degree).compare(value) <= 0) {
+        std::cout << "Invalid root of degree " << degree << " of " << value.toString() << ": " << root.toString()
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool testSmallValues() {
+    for (int64_t value = 0; value < 3000; ++value) {
+        BigIntBackend<uint8_t> remainder;
+        BigIntBackend<uint8_t> root = sqrtrem(BigIntBackend<uint8_t>(value), remainder);
+
+        if (!isValidRoot(BigIntBackend<uint8_t>(value), 2, root, remainder)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<class T>
+bool testLargeSquareRoots(std::size_t pieceCount) {
+    std::mt19937_64 generator(pieceCount);
+
+    for (int i = 0; i < 20; ++i) {
+        BigIntBackend<T> value = randomBackend<T>(pieceCount + i, generator);
+
+        BigIntBackend<T> remainder;
+        BigIntBackend<T> root = sqrtrem(value, remainder);
+
+        BigIntBackend<T> square = power(value, 2);
+
+        if (!isValidRoot(value, 2, root, remainder) || !testBigInt(isqrt(square), value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testLargeSquareRoots() {
+    return testLargeSquareRoots<uint8_t>(150) && testLargeSquareRoots<WidePiece>(40);
+}
+
+bool testNthRoots() {
+    std::mt19937_64 generator(3);
+
+    for (std::size_t degree = 1; degree < 12; ++degree) {
+        BigIntBackend<uint8_t> value = randomBackend<uint8_t>(90, generator);
+
+        BigIntBackend<uint8_t> remainder;
+        BigIntBackend<uint8_t> root = rootrem(value, degree, remainder);
+
+        if (!isValidRoot(value, degree, root, remainder) || !testBigInt(iroot(power(value, degree), degree), value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testNegativeValues() {
+    BigIntBackend<uint8_t> remainder;
+    BigIntBackend<uint8_t> root = rootrem(BigIntBackend<uint8_t>(-30), 3, remainder);
+
+    if (!testBigInt(root, BigIntBackend<uint8_t>(-3)) || !testBigInt(remainder, BigIntBackend<uint8_t>(-3))) {
+        return false;
+    }
+
+    try {
+        isqrt(BigIntBackend<uint8_t>(-4));
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Small values",        testSmallValues},
+            {"Large square roots",  testLargeSquareRoots},
+            {"Roots of any degree", testNthRoots},
+            {"Negative values",     testNegativeValues},
+    };
+
+    return runTests(tests);
+}
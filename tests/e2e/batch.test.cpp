@@ -0,0 +1,110 @@
+#include <random>
+
+#include "BigIntBatch.h"
+#include "ThreadPool.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+bool testBatch(const BigIntBatch &batch, const std::vector<BigInt> &expected) {
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        if (batch.get(i) != expected[i]) {
+            std::cout << "Element " << i << ": expected " << expected[i] << ", got " << batch.get(i) << std::endl;
+            return false;
+        }
+    }
+
+    return batch.size() == expected.size();
+}
+
+bool testElementWise(std::size_t size, std::size_t bitWidth) {
+    std::mt19937_64 generator(size * bitWidth);
+    std::vector<BigInt> first, second, sums, differences, products;
+    std::vector<int8_t> comparisons;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        first.push_back(randomBigInt(bitWidth, generator));
+        second.push_back(i % 7 == 0 ? first.back() : randomBigInt(bitWidth, generator));
+
+        sums.push_back(wrap(first[i] + second[i], bitWidth));
+        differences.push_back(wrap(first[i] - second[i], bitWidth));
+        products.push_back(wrap(first[i] * second[i], bitWidth));
+        comparisons.push_back(static_cast<int8_t>((first[i] > second[i]) - (first[i] < second[i])));
+    }
+
+    BigIntBatch firstBatch(first, bitWidth), secondBatch(second, bitWidth);
+
+    return testBatch(firstBatch, first) && testBatch(firstBatch + secondBatch, sums) &&
+           testBatch(firstBatch - secondBatch, differences) && testBatch(firstBatch * secondBatch, products) &&
+           firstBatch.compare(secondBatch) == comparisons;
+}
+
+bool testElementWise() {
+    return testElementWise(100, 32) && testElementWise(100, 64) && testElementWise(50, 256) &&
+           testElementWise(20, 1024) &&
+           BigIntBatch(1, 1000).getBitWidth() == 1024;
+}
+
+bool testScalar() {
+    std::mt19937_64 generator(5);
+    std::vector<BigInt> values, sums, differences, products;
+    BigInt scalar = randomBigInt(128, generator);
+
+    for (std::size_t i = 0; i < 50; ++i) {
+        values.push_back(randomBigInt(128, generator));
+
+        sums.push_back(wrap(values[i] + scalar, 128));
+        differences.push_back(wrap(values[i] - scalar, 128));
+        products.push_back(wrap(values[i] * scalar, 128));
+    }
+
+    BigIntBatch batch(values, 128);
+    std::vector<int8_t> comparisons = batch.compare(values[3]);
+
+    BigIntBatch sumBatch = batch, differenceBatch = batch, productBatch = batch;
+    sumBatch += scalar;
+    differenceBatch -= scalar;
+    productBatch *= scalar;
+
+    return testBatch(sumBatch, sums) && testBatch(differenceBatch, differences) &&
+           testBatch(productBatch, products) && comparisons[3] == 0 &&
+           comparisons[4] == (values[4] > values[3] ? 1 : -1);
+}
+
+bool testOverflow() {
+    BigIntBatch batch(std::vector<BigInt>{2147483647, -2147483648LL, -1}, 32);
+    batch += 1;
+
+    if (!testBatch(batch, {-2147483648LL, -2147483647, 0})) {
+        return false;
+    }
+
+    try {
+        batch.set(0, 2147483648LL);
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+bool testParallel() {
+    setThreadCount(4);
+    bool isSuccessful = testElementWise(20000, 64) && testElementWise(3000, 512);
+    setThreadCount(0);
+
+    return isSuccessful;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Element-wise operations", testElementWise},
+            {"Scalar operations",       testScalar},
+            {"Overflow",                testOverflow},
+            {"Parallel operations",     testParallel},
+    };
+
+    return runTests(tests);
+}
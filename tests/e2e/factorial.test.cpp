@@ -2,6 +2,7 @@
 #include "BigFloatMath.h"
 #include "BigInt.h"
 #include "BigFloat.h"
+#include "IsomorphicMath.h"
 #include "../utils.h"
 
 using namespace BigNumbers;
@@ -30,11 +31,71 @@ bool testBigFloatFactorial() {
     return !failure;
 }
 
+bool testPrimeSwingFactorial() {
+    BigInt expectedResult = 1;
+
+    for (std::size_t n = 1; n <= 400; ++n) {
+        expectedResult *= BigInt(static_cast<int64_t>(n));
+
+        BigInt receivedResult = IsomorphicMath::factorial<BigInt>(n);
+        if (receivedResult != expectedResult) {
+            std::cout << "Failed to compute " << n << "!\n"
+                      << "Expected: " << expectedResult << '\n'
+                      << "Received: " << receivedResult << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testDoubleFactorial() {
+    BigInt expectedResults[] = {1, 1};
+
+    for (std::size_t n = 2; n <= 300; ++n) {
+        BigInt &expectedResult = expectedResults[n % 2];
+        expectedResult *= BigInt(static_cast<int64_t>(n));
+
+        if (IsomorphicMath::doubleFactorial<BigInt>(n) != expectedResult) {
+            std::cout << "Failed to compute " << n << "!!" << std::endl;
+            return false;
+        }
+    }
+
+    return IsomorphicMath::doubleFactorial<BigInt>(0) == BigInt(1) &&
+           IsomorphicMath::doubleFactorial<BigInt>(1) == BigInt(1) &&
+           doubleFactorial(9) == BigFloat(945);
+}
+
+bool testBinomial() {
+    std::vector<BigInt> row{1};
+
+    for (std::size_t n = 1; n <= 120; ++n) {
+        std::vector<BigInt> next(n + 1, 1);
+        for (std::size_t k = 1; k < n; ++k) {
+            next[k] = row[k - 1] + row[k];
+        }
+        row.swap(next);
+
+        for (std::size_t k = 0; k <= n; ++k) {
+            if (IsomorphicMath::binomial<BigInt>(n, k) != row[k]) {
+                std::cout << "Failed to compute binomial(" << n << ", " << k << ")" << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return IsomorphicMath::binomial<BigInt>(5, 6) == BigInt(0) && binomial(10, 3) == BigFloat(120);
+}
+
 int main() {
     using test = bool (*)();
 
     std::vector<std::pair<std::string, test>> tests{
             {"Test BigFloat factorial", testBigFloatFactorial},
+            {"Prime swing factorial",   testPrimeSwingFactorial},
+            {"Double factorial",        testDoubleFactorial},
+            {"Binomial coefficient",    testBinomial},
     };
 
     return runTests(tests);
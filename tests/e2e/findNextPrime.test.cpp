@@ -1,8 +1,10 @@
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 #include "BigInt.h"
 #include "BigFloatMath.h"
+#include "ThreadPool.h"
 #include "../utils.h"
 
 using namespace BigNumbers;
@@ -19,13 +21,77 @@ bool testLargeValue() {
     return findNextPrime(BigFloat(1237521456)) == BigFloat(1237521469);
 }
 
+bool testSmallSieveWindow() {
+    return findNextPrime(BigFloat(1237521456), 7) == BigFloat(1237521469);
+}
+
+bool testPrimeGap() {
+    // First gap of 1132 integers follows this prime.
+    BigFloat value;
+    std::stringstream builder("1693182318746371.0");
+    builder >> std::setprecision(4) >> value;
+
+    return findNextPrime(value, 256) == findNextPrime(value) &&
+           findNextPrime(value) == value + BigFloat(1132);
+}
+
+bool testMultipleThreads() {
+    // Window size is small enough for several windows to be tested concurrently.
+    return findNextPrime(BigFloat(1693182318746371), 16, 4) == BigFloat(1693182318747503) &&
+           findNextPrime(BigFloat(1237521456), 4, 3) == BigFloat(1237521469);
+}
+
+bool testSingleThreadPool() {
+    // Workers are tasks of the shared pool, so they run one after another on a single thread.
+    setThreadCount(1);
+
+    bool isSuccessful = findNextPrime(BigFloat(1693182318746371), 16, 4) == BigFloat(1693182318747503) &&
+                        findPrimesInRange(BigFloat(65000), BigFloat(66000), 64, 4).size() == 98;
+
+    setThreadCount(0);
+
+    return isSuccessful;
+}
+
+bool testPrimesInRange() {
+    std::vector<BigFloat> primes = findPrimesInRange(BigFloat(65000), BigFloat(66000), 64, 4);
+
+    BigFloat sum = 0;
+    for (const BigFloat &prime: primes) {
+        sum += prime;
+    }
+
+    return primes.size() == 98 && primes.front() == BigFloat(65003) && primes.back() == BigFloat(65993) &&
+           sum == BigFloat(6418650);
+}
+
+bool testPrimesInLargeRange() {
+    std::vector<BigFloat> primes = findPrimesInRange(BigFloat(1000000000), BigFloat(1000002000));
+
+    return primes.size() == 99 && primes.front() == BigFloat(1000000007) && primes.back() == BigFloat(1000001969);
+}
+
+bool testPrimesInManyBatches() {
+    // Range spans over a hundred windows, so they are searched in several batches, which are merged in order.
+    std::vector<BigFloat> primes = findPrimesInRange(BigFloat(1000000000), BigFloat(1000002000), 16, 3);
+
+    return primes == findPrimesInRange(BigFloat(1000000000), BigFloat(1000002000)) && primes.size() == 99;
+}
+
 int main() {
     using test = bool (*)();
 
     std::vector<std::pair<std::string, test>> tests{
-            {"Test zero",        testZero},
-            {"Simple test",      testSimple},
-            {"Test large value", testLargeValue}
+            {"Test zero",               testZero},
+            {"Simple test",             testSimple},
+            {"Test large value",        testLargeValue},
+            {"Test small sieve window", testSmallSieveWindow},
+            {"Test prime gap",          testPrimeGap},
+            {"Test multiple threads",   testMultipleThreads},
+            {"Test single thread pool", testSingleThreadPool},
+            {"Primes in range",         testPrimesInRange},
+            {"Primes in large range",   testPrimesInLargeRange},
+            {"Primes in many batches",  testPrimesInManyBatches}
     };
 
     return runTests(tests);
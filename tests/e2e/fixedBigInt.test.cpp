@@ -0,0 +1,109 @@
+#include <random>
+#include <sstream>
+
+#include "FixedBigInt.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+template<std::size_t Bits>
+bool testFixed(const FixedBigInt<Bits> &value, const BigInt &expected) {
+    if (static_cast<BigInt>(value) != expected) {
+        std::cout << "Expected " << expected << ", got " << value << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+template<std::size_t Bits>
+bool testArithmetic() {
+    std::mt19937_64 generator(Bits);
+
+    for (int i = 0; i < 300; ++i) {
+        // Operands of different lengths up to the bit width are tested.
+        BigInt first = randomBigInt(32 * (generator() % (Bits / 32) + 1), generator);
+        BigInt second = randomBigInt(32 * (generator() % (Bits / 32) + 1), generator);
+        FixedBigInt<Bits> fixedFirst(first), fixedSecond(second);
+
+        if (!testFixed(fixedFirst + fixedSecond, wrap(first + second, Bits)) ||
+            !testFixed(fixedFirst - fixedSecond, wrap(first - second, Bits)) ||
+            !testFixed(fixedFirst * fixedSecond, wrap(first * second, Bits)) ||
+            (fixedFirst < fixedSecond) != (first < second) || (fixedFirst == fixedSecond) != (first == second)) {
+            return false;
+        }
+
+        if (second != 0 && (!testFixed(fixedFirst / fixedSecond, first / second) ||
+                            !testFixed(fixedFirst % fixedSecond, first % second))) {
+            std::cout << "Division of " << first << " by " << second << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testArithmetic() {
+    return testArithmetic<64>() && testArithmetic<256>() && testArithmetic<512>() && testArithmetic<1024>();
+}
+
+bool testOverflow() {
+    BigInt limit = 1;
+    for (int i = 0; i < 127; ++i) {
+        limit *= 2;
+    }
+
+    FixedBigInt<128> maximum(limit - 1);
+    FixedBigInt<128> minimum = maximum;
+    ++minimum;
+
+    if (!testFixed(minimum, -limit) || minimum >= maximum || -minimum != minimum || minimum / -1 != minimum ||
+        --minimum != maximum) {
+        return false;
+    }
+
+    try {
+        FixedBigInt<64> tooBig(BigInt(INT64_MAX) + 1);
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+bool testDivisionByZero() {
+    try {
+        FixedBigInt<256>(5) / FixedBigInt<256>();
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
+bool testCompileTime() {
+    constexpr FixedBigInt<256> negative(-5);
+    constexpr FixedBigInt<256> positive(5u);
+    static_assert(FixedBigInt<256>::getBitWidth() == 256, "Width is known at compile time");
+
+    std::stringstream stream;
+    stream << negative << ' ' << positive;
+
+    FixedBigInt<256> parsed;
+    stream >> parsed;
+
+    return stream.str() == "-5 5" && parsed == negative && positive + negative == 0;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Arithmetic",          testArithmetic},
+            {"Overflow",            testOverflow},
+            {"Division by zero",    testDivisionByZero},
+            {"Compile-time values", testCompileTime},
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,206 @@
+#include <iostream>
+#include <vector>
+
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+#include "BigInterval.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+// Reference values are read at a precision far above the one of tested intervals.
+constexpr std::size_t REFERENCE_PRECISION = 22;
+
+bool testContains(const BigInterval &interval, const BigFloat &expected, const std::string &name) {
+    if (!interval.contains(expected)) {
+        std::cout << name << " = " << std::setprecision(40) << interval << " does not contain "
+                  << std::setprecision(40) << expected << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool testArithmetic() {
+    PrecisionScope scope(1);
+
+    BigInterval third = BigInterval(1) / BigInterval(3);
+
+    if (!(third * BigInterval(3)).contains(1) || !(third - third).contains(0) || third.getWidth() <= 0) {
+        std::cout << "Wrong bounds of 1/3: " << std::setprecision(10) << third << std::endl;
+        return false;
+    }
+
+    PrecisionScope exactScope(8);
+
+    if (third.getLower() * 3 > 1 || third.getUpper() * 3 < 1) {
+        std::cout << "Interval " << std::setprecision(10) << third << " does not contain 1/3" << std::endl;
+        return false;
+    }
+
+    BigInterval product = BigInterval(BigFloat(-2), BigFloat(3)) * BigInterval(BigFloat(-5), BigFloat(4));
+
+    return product.getLower() == -15 && product.getUpper() == 12;
+}
+
+bool testSqrt() {
+    BigInterval root;
+
+    {
+        PrecisionScope scope(2);
+        root = sqrt(BigInterval(2));
+    }
+
+    PrecisionScope exactScope(8);
+
+    return root.getLower() * root.getLower() <= 2 && root.getUpper() * root.getUpper() >= 2 &&
+           sqrt(BigInterval(BigFloat(-1), BigFloat(4))).getLower() == 0;
+}
+
+bool testPi() {
+    auto input = safeRelativeOpen("pi.txt");
+    std::string digits;
+    input >> digits;
+    input.close();
+
+    BigFloat expected = parseBigFloat(digits, REFERENCE_PRECISION);
+
+    for (std::size_t precision: {1, 2, 4, 8}) {
+        PrecisionScope scope(precision);
+
+        if (!testContains(BigInterval::pi(), expected, "pi")) {
+            return false;
+        }
+    }
+
+    PrecisionScope scope(4);
+
+    return BigInterval::pi().isAccurateTo(18);
+}
+
+bool testFunction(const std::string &path, BigInterval (*function)(const BigInterval &), const std::string &name) {
+    auto input = safeRelativeOpen(path);
+
+    while (!input.eof()) {
+        std::string argumentString, expectedString;
+        input >> argumentString >> expectedString;
+
+        if (argumentString.empty()) {
+            break;
+        }
+
+        BigFloat argument = parseBigFloat(argumentString, REFERENCE_PRECISION);
+        BigFloat expected = parseBigFloat(expectedString, REFERENCE_PRECISION);
+
+        for (std::size_t precision: {1, 4}) {
+            PrecisionScope scope(precision);
+
+            if (!testContains(function(BigInterval(argument)), expected, name + "(" + argumentString + ")")) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool testSin() {
+    return testFunction("sin.txt", sin, "sin");
+}
+
+bool testLn() {
+    return testFunction("ln.txt", ln, "ln");
+}
+
+bool testLargeArgument() {
+    BigFloat argument = 1000000, expected;
+
+    {
+        PrecisionScope scope(REFERENCE_PRECISION);
+        expected = sin(argument);
+    }
+
+    PrecisionScope scope(4);
+
+    return testContains(sin(BigInterval(argument)), expected, "sin(1000000)");
+}
+
+bool testWideArgument() {
+    PrecisionScope scope(2);
+
+    BigInterval sine = sin(BigInterval(BigFloat(1), BigFloat(2)));
+
+    // Sine grows on [1, 2] up to one at pi/2, interval from the mean value theorem is wider, but not beyond one.
+    return sine.contains(sin(BigFloat(1))) && sine.contains(1) && sine.getUpper() <= 1;
+}
+
+bool testIncreasingPrecision() {
+    // Computation is repeated at a doubled precision until the result is accurate enough.
+    std::size_t precision = 1;
+    BigInterval result;
+
+    while (true) {
+        PrecisionScope scope(precision);
+        result = ln(sin(BigInterval(1)) + sqrt(BigInterval(2)));
+
+        if (result.isAccurateTo(30)) {
+            break;
+        }
+
+        precision *= 2;
+    }
+
+    if (precision > 8) {
+        std::cout << "Precision grew up to " << precision << std::endl;
+        return false;
+    }
+
+    BigFloat expected;
+
+    {
+        PrecisionScope scope(REFERENCE_PRECISION);
+        expected = ln(sin(BigFloat(1)) + sqrt(BigFloat(2)));
+    }
+
+    return testContains(result, expected, "ln(sin(1) + sqrt(2))");
+}
+
+bool testErrors() {
+    try {
+        BigInterval(1) / BigInterval(BigFloat(-1), BigFloat(1));
+        return false;
+    } catch (std::logic_error &) {
+    }
+
+    try {
+        ln(BigInterval(BigFloat(0), BigFloat(1)));
+        return false;
+    } catch (std::logic_error &) {
+    }
+
+    try {
+        BigInterval(BigFloat(2), BigFloat(1));
+        return false;
+    } catch (std::logic_error &) {
+    }
+
+    return true;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Arithmetic",           testArithmetic},
+            {"Square root",          testSqrt},
+            {"Pi",                   testPi},
+            {"Sine",                 testSin},
+            {"Logarithm",            testLn},
+            {"Large argument",       testLargeArgument},
+            {"Wide argument",        testWideArgument},
+            {"Increasing precision", testIncreasingPrecision},
+            {"Errors",               testErrors},
+    };
+
+    return runTests(tests);
+}
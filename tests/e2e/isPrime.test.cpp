@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+
+#include "BigInt.h"
+#include "IsomorphicMath.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+bool testSmallValues() {
+    std::vector<int> primes{2, 3, 5, 7, 11, 13, 97, 101, 7919};
+    std::vector<int> composites{0, 1, 4, 9, 91, 561, 7917};
+
+    for (int prime: primes) {
+        if (!IsomorphicMath::isPrime(BigInt(prime))) {
+            std::cout << prime << " was not recognized as prime" << std::endl;
+            return false;
+        }
+    }
+
+    for (int composite: composites) {
+        if (IsomorphicMath::isPrime(BigInt(composite))) {
+            std::cout << composite << " was recognized as prime" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testStrongPseudoprimes() {
+    // Strong pseudoprime to bases 2, 3, 5 and 7.
+    BigInt pseudoprime = parseBigInt("3215031751");
+
+    // Strong pseudoprime to all prime bases up to 23.
+    BigInt strongerPseudoprime = parseBigInt("3825123056546413051");
+
+    return !IsomorphicMath::isPrime(pseudoprime) && !IsomorphicMath::bailliePSW(pseudoprime) &&
+           !IsomorphicMath::bailliePSW(strongerPseudoprime) &&
+           IsomorphicMath::isPrime64(4294967291u) && !IsomorphicMath::isPrime64(UINT64_C(3825123056546413051));
+}
+
+bool testLargePrime() {
+    // 2^89 - 1 is a Mersenne prime.
+    BigInt prime = parseBigInt("618970019642690137449562111");
+
+    return IsomorphicMath::isPrime(prime) && IsomorphicMath::millerRabin(prime, 8);
+}
+
+bool testLargeComposite() {
+    // Product of two primes close to 2^45, and a Carmichael number.
+    BigInt semiprime = parseBigInt("1237940039290094980759032137");
+    BigInt carmichael = parseBigInt("1152271");
+
+    return !IsomorphicMath::isPrime(semiprime) && !IsomorphicMath::millerRabin(semiprime, 8) &&
+           !IsomorphicMath::bailliePSW(carmichael);
+}
+
+bool testThirtyDigitNextPrime() {
+    BigInt value = parseBigInt("1000000000000000000000000000000");
+
+    return IsomorphicMath::findNextPrime(value) == parseBigInt("1000000000000000000000000000057");
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Small values",            testSmallValues},
+            {"Strong pseudoprimes",     testStrongPseudoprimes},
+            {"Large prime",             testLargePrime},
+            {"Large composite",         testLargeComposite},
+            {"Thirty digit next prime", testThirtyDigitNextPrime}
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,62 @@
+#include "BigInt.h"
+#include "BigIntMath.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+// Compares fast evaluation with straightforward iteration of the recurrence.
+bool testAgainstIteration(const std::vector<BigInt> &coefficients, const std::vector<BigInt> &initialValues,
+                          uint64_t count) {
+    std::vector<BigInt> values = initialValues;
+
+    for (uint64_t n = 0; n < count; ++n) {
+        if (n >= values.size()) {
+            BigInt next = 0;
+            for (std::size_t j = 0; j < coefficients.size(); ++j) {
+                next += coefficients[j] * values[n - 1 - j];
+            }
+            values.push_back(next);
+        }
+
+        BigInt receivedResult = linearRecurrence(coefficients, initialValues, n);
+        if (receivedResult != values[n]) {
+            std::cout << "Failed to compute term " << n << "\n"
+                      << "Expected: " << values[n] << '\n'
+                      << "Received: " << receivedResult << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool testTribonacci() {
+    return testAgainstIteration({1, 1, 1}, {0, 0, 1}, 300);
+}
+
+bool testNegativeCoefficients() {
+    return testAgainstIteration({2, -1}, {5, 8}, 100) && testAgainstIteration({0, 0, 0, -3}, {1, -2, 3, 4}, 200);
+}
+
+bool testFirstOrder() {
+    return testAgainstIteration({3}, {7}, 100);
+}
+
+bool testFibonacci() {
+    return fibonacci(1000) == linearRecurrence({1, 1}, {0, 1}, 1000) &&
+           lucas(1000) == linearRecurrence({1, 1}, {2, 1}, 1000) && fibonacci(0) == BigInt(0) &&
+           lucas(0) == BigInt(2);
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Tribonacci numbers",    testTribonacci},
+            {"Negative coefficients", testNegativeCoefficients},
+            {"First order",           testFirstOrder},
+            {"Fibonacci numbers",     testFibonacci},
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,35 @@
+#include "Literals.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+bool testIntegers() {
+    return 0_bi == 0 && 1103_bi == 1103 && 255_bi == 255 && -26390_bi == -26390 &&
+           123456789012345678901234567890_bi == parseBigInt("123456789012345678901234567890");
+}
+
+bool testPrefixes() {
+    return 0xFF_bi == 255 && 0XdeadBEEF_bi == 3735928559LL && 0b101_bi == 5 && 0B11111111_bi == 255 && 017_bi == 15 &&
+           0x10000000000000000000000000000000_bi == parseBigInt("21267647932558653966460912964485513216");
+}
+
+bool testFloats() {
+    PrecisionScope scope(8);
+    BigFloat error = 1.1_bf * 10_bf - 11_bf;
+
+    return 0.5_bf + 0.5_bf == 1_bf && 0.375_bf * 8_bf == 3_bf && 2.0_bf == BigFloat(2) && 1e3_bf == BigFloat(1000) &&
+           15e-1_bf == 1.5_bf && 0.25E+1_bf == 2.5_bf && error < 1e-9_bf && error > -1e-9_bf &&
+           (1.5_bf).getPrecision() == 8;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Integer literals",  testIntegers},
+            {"Integer prefixes",  testPrefixes},
+            {"Floating literals", testFloats},
+    };
+
+    return runTests(tests);
+}
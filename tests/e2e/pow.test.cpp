@@ -4,6 +4,7 @@
 #include "BigInt.h"
 #include "BigFloat.h"
 #include "BigFloatMath.h"
+#include "BigIntMath.h"
 #include "../utils.h"
 
 using namespace BigNumbers;
@@ -42,14 +43,52 @@ bool testBigFloat2() {
     return areFloatsEqual(pow(value, 1), BigFloat(0.3), 3);
 }
 
+bool testNegativePower() {
+    BigFloat value = 4;
+
+    return areFloatsEqual(pow(value, -3), BigFloat(0.015625), 3) &&
+           areFloatsEqual(pow(BigFloat(3), -2) * BigFloat(9), BigFloat(1), 3);
+}
+
+bool testLargePower() {
+    BigInt expectedResult = 1;
+    for (int i = 0; i < 1000; ++i) {
+        expectedResult *= BigInt(3);
+    }
+
+    return pow(BigInt(3), 1000) == expectedResult && pow(BigInt(3), BigInt(1000)) == expectedResult &&
+           pow(BigInt(-2), 63) == -(BigInt(INT64_C(1) << 62) * BigInt(2)) && pow(BigInt(7), 0) == BigInt(1);
+}
+
+bool testBigIntPower() {
+    BigFloat value = 2;
+
+    return pow(value, BigInt(100)) == BigFloat(pow(BigInt(2), 100)) &&
+           areFloatsEqual(pow(value, BigInt(-2)), BigFloat(0.25), 3);
+}
+
+bool testNegativeIntegerPower() {
+    try {
+        pow(BigInt(2), -1);
+    } catch (std::logic_error &) {
+        return true;
+    }
+
+    return false;
+}
+
 int main() {
     using test = bool (*)();
 
     std::vector<std::pair<std::string, test>> tests{
-            {"BigInt test",     testBigInt},
-            {"BigInt test 2",   testBigInt2},
-            {"BigFloat test",   testBigFloat},
-            {"BigFloat test 2", testBigFloat2}
+            {"BigInt test",            testBigInt},
+            {"BigInt test 2",          testBigInt2},
+            {"BigFloat test",          testBigFloat},
+            {"BigFloat test 2",        testBigFloat2},
+            {"Negative power",         testNegativePower},
+            {"Large power",            testLargePower},
+            {"BigInt power",           testBigIntPower},
+            {"Negative integer power", testNegativeIntegerPower}
     };
 
     return runTests(tests);
@@ -0,0 +1,122 @@
+#include <sstream>
+#include <thread>
+
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+std::string toString(const BigFloat &value) {
+    std::stringstream builder;
+    builder << std::setprecision(60) << value;
+    return builder.str();
+}
+
+bool testNestedScopes() {
+    std::size_t defaultPrecision = BigFloat::getDefaultPrecision();
+    bool isSuccessful;
+
+    {
+        PrecisionScope outer(20);
+        isSuccessful = BigFloat().getPrecision() == 20 && BigFloat(3).getPrecision() == 20;
+
+        {
+            PrecisionScope inner(3);
+            isSuccessful = isSuccessful && BigFloat::getDefaultPrecision() == 3 && BigFloat(0.5).getPrecision() == 3;
+        }
+
+        isSuccessful = isSuccessful && BigFloat::getDefaultPrecision() == 20;
+    }
+
+    return isSuccessful && BigFloat::getDefaultPrecision() == defaultPrecision;
+}
+
+bool testParsing() {
+    std::stringstream input("1.5 2.25");
+    BigFloat first, second;
+
+    input >> std::setprecision(4) >> first;
+
+    {
+        PrecisionScope scope(12);
+        input >> second;
+    }
+
+    return first.getPrecision() == 4 && second.getPrecision() == 12;
+}
+
+bool testBitPrecision() {
+    BigFloat third(1);
+    third.setBitPrecision(20);
+    third /= BigFloat(3);
+
+    // 1/3 rounded to 20 bits after its leading bit is 699051 / 2^21.
+    std::stringstream builder;
+    builder << std::fixed << std::setprecision(18) << third;
+
+    return third.getBitPrecision() == 20 && builder.str() == "0.333333492279052734";
+}
+
+// Results keep the same significant bits, wherever their leading bit lies within a piece.
+bool testBitPrecisionAlignment() {
+    BigFloat third(1);
+    third.setBitPrecision(20);
+    third /= BigFloat(3);
+
+    for (int shift = 0; shift < 40; ++shift) {
+        BigFloat scaled(int64_t(1) << shift);
+        scaled.setBitPrecision(20);
+        scaled /= BigFloat(3);
+
+        if (scaled != third * BigFloat(int64_t(1) << shift)) {
+            std::cout << "Shift " << shift << ": " << toString(scaled) << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Threads with different precisions must get the same results as sequential computations at those precisions.
+bool testIndependentThreads() {
+    std::string expectedResults[2], receivedResults[2];
+    const std::size_t precisions[] = {4, 16};
+
+    for (int i = 0; i < 2; ++i) {
+        PrecisionScope scope(precisions[i]);
+        expectedResults[i] = toString(sqrt(BigFloat(2)) + ln(BigFloat(3)));
+    }
+
+    std::thread workers[2];
+    for (int i = 0; i < 2; ++i) {
+        workers[i] = std::thread([&receivedResults, &precisions, i]() {
+            PrecisionScope scope(precisions[i]);
+
+            for (int repetition = 0; repetition < 3; ++repetition) {
+                receivedResults[i] = toString(sqrt(BigFloat(2)) + ln(BigFloat(3)));
+            }
+        });
+    }
+
+    for (auto &worker: workers) {
+        worker.join();
+    }
+
+    return expectedResults[0] != expectedResults[1] && receivedResults[0] == expectedResults[0] &&
+           receivedResults[1] == expectedResults[1];
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Nested scopes",         testNestedScopes},
+            {"Parsing in scope",      testParsing},
+            {"Independent threads",   testIndependentThreads},
+            {"Bit precision",         testBitPrecision},
+            {"Aligned bit precision", testBitPrecisionAlignment},
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,89 @@
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+BigFloat divide(int dividend, int divisor, RoundingMode mode) {
+    RoundingScope scope(mode);
+    return BigFloat(dividend) / BigFloat(divisor);
+}
+
+bool testModes() {
+    PrecisionScope scope(1);
+    BigFloat unit = BigFloat::epsilon(1);
+
+    // 1/3 = 0.0101...01|01..., which rounds to nearest downwards, while 2/3 = 0.1010...10|10... rounds upwards.
+    BigFloat third = divide(1, 3, RoundingMode::NEAREST_EVEN);
+    BigFloat twoThirds = divide(2, 3, RoundingMode::NEAREST_EVEN);
+
+    return third == divide(1, 3, RoundingMode::DOWN) && third == divide(1, 3, RoundingMode::TOWARD_ZERO) &&
+           divide(1, 3, RoundingMode::UP) - third == unit &&
+           twoThirds == divide(2, 3, RoundingMode::UP) && twoThirds - divide(2, 3, RoundingMode::DOWN) == unit &&
+           divide(-1, 3, RoundingMode::TOWARD_ZERO) == -third && divide(-1, 3, RoundingMode::DOWN) == -third - unit;
+}
+
+bool testInexactFlag() {
+    BigFloat::clearInexact();
+    BigFloat quarter = BigFloat(1) / BigFloat(4);
+    BigFloat root = sqrt(BigFloat(49) / BigFloat(4));
+
+    if (BigFloat::isInexact() || root != BigFloat(7) / BigFloat(2)) {
+        return false;
+    }
+
+    BigFloat third = BigFloat(1) / BigFloat(3);
+
+    bool isRaised = BigFloat::isInexact();
+    BigFloat::clearInexact();
+
+    return isRaised && !BigFloat::isInexact();
+}
+
+bool testScope() {
+    {
+        RoundingScope outer(RoundingMode::UP);
+
+        {
+            RoundingScope inner(RoundingMode::DOWN);
+            if (BigFloat::getRoundingMode() != RoundingMode::DOWN) {
+                return false;
+            }
+        }
+
+        if (BigFloat::getRoundingMode() != RoundingMode::UP) {
+            return false;
+        }
+    }
+
+    return BigFloat::getRoundingMode() == RoundingMode::NEAREST_EVEN;
+}
+
+bool testSqrtBounds() {
+    PrecisionScope scope(4);
+
+    BigFloat lower, upper;
+    {
+        RoundingScope down(RoundingMode::DOWN);
+        lower = sqrt(BigFloat(2));
+    }
+    {
+        RoundingScope up(RoundingMode::UP);
+        upper = sqrt(BigFloat(2));
+    }
+
+    return lower * lower < BigFloat(2) && upper * upper > BigFloat(2) && upper - lower == BigFloat::epsilon(4);
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Rounding modes", testModes},
+            {"Inexact flag",   testInexactFlag},
+            {"Rounding scope", testScope},
+            {"Bounds of sqrt", testSqrtBounds},
+    };
+
+    return runTests(tests);
+}
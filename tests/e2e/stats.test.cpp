@@ -0,0 +1,78 @@
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+#include "BigInt.h"
+#include "Stats.h"
+#include "config.h"
+#include "../utils.h"
+
+using namespace BigNumbers;
+
+BigInt powerOfTwo(int exponent) {
+    BigInt result = 1;
+    for (int i = 0; i < exponent; ++i) {
+        result *= 2;
+    }
+
+    return result;
+}
+
+bool testIntegerCounters() {
+    BigInt first = powerOfTwo(4000) - 1, second = powerOfTwo(3000) + 7;
+
+    Stats::reset();
+    BigInt product = first * second;
+    BigInt quotient = product / powerOfTwo(100);
+    Stats::Snapshot stats = Stats::snapshot();
+
+    if (!Stats::isEnabled()) {
+        return stats.multiplications == 0 && stats.limbsProcessed == 0 && stats.allocations == 0 &&
+               stats.normalizations == 0 && quotient == product / powerOfTwo(100);
+    }
+
+    // Operands are longer than threshold of Karatsuba method, divisor is longer than a piece.
+    return stats.multiplications >= 1 && stats.karatsubaMultiplications + stats.parallelMultiplications >= 1 &&
+           stats.divisions >= 1 && stats.longDivisions >= 1 && stats.comparisons > 0 && stats.normalizations > 0 &&
+           stats.limbsProcessed > 7000 / (8 * sizeof(PieceType)) && stats.allocations > 0 &&
+           stats.allocatedBytes >= stats.allocations && quotient == product / powerOfTwo(100);
+}
+
+bool testFloatCounters() {
+    PrecisionScope scope(8);
+    BigFloat two(2);
+
+    Stats::reset();
+    BigFloat root = sqrt(two);
+    BigFloat half = BigFloat(1) / two;
+
+    // Product and sum are taken explicitly, so that counters do not depend on how sqrt and division are computed.
+    BigFloat sum = root * root + half;
+    Stats::Snapshot stats = Stats::snapshot();
+
+    if (!Stats::isEnabled()) {
+        return stats.floatDivisions == 0 && stats.newtonIterations == 0;
+    }
+
+    return stats.floatDivisions >= 1 && stats.floatMultiplications > 0 && stats.floatAdditions > 0 &&
+           stats.newtonIterations > 0 && stats.schoolbookMultiplications > 0 && root > half && sum > 2;
+}
+
+bool testReset() {
+    BigInt value = powerOfTwo(100) * 3;
+    Stats::reset();
+    Stats::Snapshot stats = Stats::snapshot();
+
+    return value > 0 && stats.additions == 0 && stats.multiplications == 0 && stats.normalizations == 0 &&
+           stats.limbsProcessed == 0 && stats.allocations == 0 && stats.newtonIterations == 0;
+}
+
+int main() {
+    using test = bool (*)();
+
+    std::vector<std::pair<std::string, test>> tests{
+            {"Integer counters", testIntegerCounters},
+            {"Float counters",   testFloatCounters},
+            {"Reset",            testReset},
+    };
+
+    return runTests(tests);
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BigFloat.h"
+#include "BigFloatMath.h"
+
+// Scaled-up versions of e2e workloads, which are timed against stored baseline. Usage:
+//   perf_workloads WORKLOAD BASELINE RATIO    fails, when workload is slower than RATIO times its baseline
+//   perf_workloads --record WORKLOAD BASELINE measures workload and updates its baseline
+
+using namespace BigNumbers;
+
+// Each workload is repeated this amount of times and the fastest run is taken, which filters out scheduling noise.
+constexpr int RUN_COUNT = 5;
+
+// Workloads return length of their result, which is accumulated here, so that computation is not dropped.
+volatile std::size_t sink = 0;
+
+std::size_t computePi() {
+    PrecisionScope scope(2100);
+    return pi(10000).getPrecision();
+}
+
+std::size_t computeSqrt() {
+    PrecisionScope scope(10000);
+    return sqrt(BigFloat(2)).getPrecision();
+}
+
+std::size_t computeSin() {
+    PrecisionScope scope(1000);
+    return sin(BigFloat(1) / BigFloat(3)).getPrecision();
+}
+
+std::size_t computeLn() {
+    PrecisionScope scope(1000);
+    return ln(BigFloat(3) / BigFloat(4)).getPrecision();
+}
+
+std::size_t computePow() {
+    PrecisionScope scope(4000);
+    return pow(BigFloat(3) / BigFloat(2), 1000000).getPrecision();
+}
+
+std::size_t computeFactorial() {
+    return factorial(100000).getPrecision();
+}
+
+std::size_t computeNextPrime() {
+    PrecisionScope scope(64);
+    return findNextPrime(pow(BigFloat(10), 300)).getPrecision();
+}
+
+std::size_t printDigits() {
+    // Value is computed by the first run only, so the fastest run times printing alone.
+    static const BigFloat value = [] {
+        PrecisionScope scope(21000);
+        return sqrt(BigFloat(2));
+    }();
+
+    std::stringstream builder;
+    builder << std::setprecision(100000) << value;
+
+    return builder.str().length();
+}
+
+std::size_t parseDigits() {
+    // Source is printed by the first run only, so the fastest run times parsing alone.
+    static const std::string source = [] {
+        PrecisionScope scope(21000);
+        std::stringstream builder;
+        builder << std::setprecision(100000) << sqrt(BigFloat(2));
+        return builder.str();
+    }();
+
+    PrecisionScope scope(21000);
+    std::stringstream builder(source);
+    BigFloat value;
+    builder >> value;
+
+    return value.getPrecision();
+}
+
+const std::vector<std::pair<std::string, std::size_t (*)()>> WORKLOADS{
+        {"pi",            computePi},
+        {"sqrt",          computeSqrt},
+        {"sin",           computeSin},
+        {"ln",            computeLn},
+        {"pow",           computePow},
+        {"factorial",     computeFactorial},
+        {"findNextPrime", computeNextPrime},
+        {"print",         printDigits},
+        {"parse",         parseDigits},
+};
+
+double measure(std::size_t (*workload)()) {
+    using Clock = std::chrono::steady_clock;
+
+    double best = 0;
+
+    for (int run = 0; run < RUN_COUNT; ++run) {
+        auto start = Clock::now();
+        sink = sink + workload();
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        best = run == 0 ? elapsed : std::min(best, elapsed);
+    }
+
+    return best;
+}
+
+// Baseline holds lines "workload seconds", lines starting with '#' are comments.
+std::map<std::string, double> readBaseline(const std::string &path) {
+    std::map<std::string, double> baseline;
+    std::ifstream input(path);
+    std::string line;
+
+    while (std::getline(input, line)) {
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+
+        std::stringstream builder(line);
+        std::string name;
+        double seconds;
+
+        if (builder >> name >> seconds) {
+            baseline[name] = seconds;
+        }
+    }
+
+    return baseline;
+}
+
+// Measures workload and replaces its entry in baseline, keeping the other ones.
+int record(std::size_t (*workload)(), const std::string &name, const std::string &path) {
+    auto baseline = readBaseline(path);
+    baseline[name] = measure(workload);
+
+    std::ofstream output(path);
+
+    if (!output) {
+        std::cout << "Failed to write baseline \"" << path << '"' << std::endl;
+        return 1;
+    }
+
+    output << "# Wall time in seconds of perf workloads, fastest of " << RUN_COUNT << " runs of a release build.\n"
+           << "# Rewritten by building target perf_baseline.\n";
+
+    for (const auto &entry: baseline) {
+        output << entry.first << ' ' << entry.second << '\n';
+    }
+
+    std::cout << name << ": " << baseline[name] << " s" << std::endl;
+
+    return 0;
+}
+
+// Each workload is measured by separate process, so that caches filled by one do not speed up the others.
+int run(const std::string &name, const std::string &path, double ratio, bool isRecord) {
+    auto workload = std::find_if(WORKLOADS.begin(), WORKLOADS.end(),
+                                 [&name](const std::pair<std::string, std::size_t (*)()> &entry) {
+                                     return entry.first == name;
+                                 });
+
+    if (workload == WORKLOADS.end()) {
+        std::cout << "Unknown workload \"" << name << '"' << std::endl;
+        return 1;
+    }
+
+    if (isRecord) {
+        return record(workload->second, name, path);
+    }
+
+    double seconds = measure(workload->second);
+    std::cout << name << ": " << seconds << " s" << std::endl;
+
+    auto baseline = readBaseline(path);
+    auto expected = baseline.find(name);
+
+    if (expected == baseline.end()) {
+        std::cout << "No baseline for \"" << name << "\" in \"" << path << "\", nothing to compare." << std::endl;
+        return 0;
+    }
+
+    std::cout << "Baseline: " << expected->second << " s, allowed ratio: " << ratio << std::endl;
+
+    if (seconds > expected->second * ratio) {
+        std::cout << "Workload is " << seconds / expected->second << " times slower than baseline." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+
+    if (arguments.size() == 3 && arguments[0] == "--record") {
+        return run(arguments[1], arguments[2], 0, true);
+    }
+
+    if (arguments.size() == 3) {
+        return run(arguments[0], arguments[1], std::stod(arguments[2]), false);
+    }
+
+    std::cout << "Usage: perf_workloads WORKLOAD BASELINE RATIO | perf_workloads --record WORKLOAD BASELINE"
+              << std::endl;
+
+    return 1;
+}
@@ -3,10 +3,23 @@
 
 #include <iostream>
 #include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
 
+#include "BigFloat.h"
+#include "BigInt.h"
 #include "BigIntBackend.h"
 #include "BigFloatBackend.h"
 
+// Piece type of tests of wide pieces. Products of 64-bit pieces need 128-bit integers, so compilers without them test
+// 8-bit pieces instead.
+#ifdef __SIZEOF_INT128__
+using WidePiece = uint64_t;
+#else
+using WidePiece = uint8_t;
+#endif
+
 enum class BigIntComparisonResult : uint8_t {
     SIGNS_NOT_MATCH = 0,
     LENGTHS_NOT_MATCH = 1,
@@ -81,6 +94,71 @@ bool testBigFloat(const BigNumbers::BigFloatBackend<T> &received, const BigNumbe
     return true;
 }
 
+// Non-negative value of exactly given amount of random pieces.
+template<class T>
+BigNumbers::BigIntBackend<T> randomBackend(std::size_t pieceCount, std::mt19937_64 &generator) {
+    std::vector<T> pieces;
+    for (std::size_t i = 1; i < pieceCount; ++i) {
+        pieces.push_back(static_cast<T>(generator()));
+    }
+    pieces.push_back(static_cast<T>(generator() | 1));
+    return BigNumbers::BigIntBackend<T>(false, pieces);
+}
+
+template<class T>
+BigNumbers::BigIntBackend<T> power(const BigNumbers::BigIntBackend<T> &base, std::size_t exponent) {
+    BigNumbers::BigIntBackend<T> result(1);
+    for (std::size_t i = 0; i < exponent; ++i) {
+        result.multiply(base);
+    }
+    return result;
+}
+
+// Reduces value into signed range of given bit width, as fixed-width arithmetic does.
+BigNumbers::BigInt wrap(const BigNumbers::BigInt &value, std::size_t bitWidth) {
+    BigNumbers::BigInt modulus = 1;
+    for (std::size_t i = 0; i < bitWidth; ++i) {
+        modulus *= 2;
+    }
+
+    BigNumbers::BigInt result = value % modulus;
+    if (value < 0 && result != 0) {
+        result = modulus - result;
+    }
+
+    return result >= modulus / 2 ? result - modulus : result;
+}
+
+// Random value in signed range of given bit width, which is a multiple of 32.
+BigNumbers::BigInt randomBigInt(std::size_t bitWidth, std::mt19937_64 &generator) {
+    BigNumbers::BigInt result = 0;
+    for (std::size_t i = 0; i < bitWidth; i += 32) {
+        result = result * 4294967296 + static_cast<int64_t>(generator() & 0xFFFFFFFF);
+    }
+
+    return wrap(result, bitWidth);
+}
+
+// Reads value by input operator of the stream.
+BigNumbers::BigInt parseBigInt(const std::string &source) {
+    std::stringstream builder(source);
+    BigNumbers::BigInt value;
+    builder >> value;
+
+    return value;
+}
+
+// Reads value by input operator of the stream at given precision.
+BigNumbers::BigFloat parseBigFloat(const std::string &source, std::size_t precision) {
+    BigNumbers::PrecisionScope scope(precision);
+
+    std::stringstream builder(source);
+    BigNumbers::BigFloat value;
+    builder >> value;
+
+    return value;
+}
+
 #define safeRelativeOpen(filename) safeRelativeOpenImpl(__FILE__, filename)
 
 std::ifstream safeRelativeOpenImpl(const std::string &current, const std::string &filename) {